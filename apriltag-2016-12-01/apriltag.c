@@ -39,12 +39,22 @@ either expressed or implied, of the Regents of The University of Michigan.
 #include <stdio.h>
 #include <inttypes.h>
 
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 #include "common/image_u8.h"
 #include "common/image_u8x3.h"
 #include "common/zhash.h"
 #include "common/zarray.h"
 #include "common/matd.h"
 #include "common/homography.h"
+#include "common/homography_sample.h"
 #include "common/timeprofile.h"
 #include "common/math_util.h"
 #include "common/g2d.h"
@@ -115,17 +125,131 @@ double graymodel_interpolate(struct graymodel *gm, double x, double y)
 struct quick_decode_entry
 {
     uint64_t rcode;   // the queried code
+    const apriltag_family_t *family;
     uint16_t id;      // the tag ID (a small integer)
     uint8_t hamming;  // how many errors corrected?
     uint8_t rotation; // number of rotations [0, 3]
 };
 
-struct quick_decode
+// An index decodes the codes of one or more families of the same
+// geometry; their codes are numbered consecutively, and the index of
+// a code is called its id below.
+//
+// The decode table maps every codeword within maxhamming bits of any
+// of the four rotations of a code to that code's id and rotation, so
+// that a quad is decoded with a single lookup. A slot packs a
+// fingerprint of the codeword's hash (upper 46 bits), the rotation (2
+// bits) and the id (lower 16 bits); 0 marks an empty slot. The
+// codeword itself need not be stored: a fingerprint hit is confirmed
+// against the rotated code, which also yields the hamming distance.
+//
+// Slots are grouped into buckets of one 64-byte cache line. The
+// bucket index is the top bits of a multiplicative hash, and a full
+// bucket overflows into the next one, so a lookup usually touches a
+// single cache line.
+#define QUICK_DECODE_BUCKET_SLOTS 8
+#define QUICK_DECODE_ID_MASK      0xffffULL
+#define QUICK_DECODE_ROTATION_SHIFT 16
+#define QUICK_DECODE_PAYLOAD_MASK 0x3ffffULL
+
+// The multi-index decoder splits the code bits into more substrings
+// than maxhamming; a code within maxhamming bits of the query then
+// matches it exactly on at least one substring. Each substring indexes
+// the ids of the codes having each possible value (in CSR form), and
+// the candidates are verified with a popcount. Memory is
+// O(nsubstrings * (2^bits + ncodes)) regardless of maxhamming.
+#define QUICK_DECODE_SUBSTRING_MAXBITS 16
+
+struct quick_decode_substring
+{
+    int shift;
+    uint64_t mask;
+
+    uint32_t *offsets; // (mask+2) entries
+    uint16_t *ids;     // ncodes entries
+};
+
+// Reads the code of a quad of family's geometry; see
+// quad_sample_code_geometry(). The kernel used for a family is chosen
+// once, when its decode index is created.
+typedef float (*quad_sample_code_t)(const apriltag_family_t *family, image_u8_t *im, const struct quad *quad,
+                                    int sampling, float min_margin, uint64_t *prcode, image_u8_t *im_samples);
+
+// returns a kernel specialized for the geometry if there is one, else
+// the generic quad_sample_code().
+quad_sample_code_t quad_sample_code_kernel(uint32_t d, uint32_t black_border);
+
+#if defined(_MSC_VER)
+#define QUAD_SAMPLE_INLINE static __forceinline
+#elif defined(__GNUC__)
+#define QUAD_SAMPLE_INLINE static inline __attribute__((always_inline))
+#else
+#define QUAD_SAMPLE_INLINE static inline
+#endif
+
+struct apriltag_decode_index
 {
-    int nentries;
-    struct quick_decode_entry *entries;
+    // codes[id] is families[f]->codes[id - code_base[f]] for
+    // code_base[f] <= id < code_base[f+1].
+    int nfamilies;
+    const apriltag_family_t **families;
+    uint32_t *code_base;
+    uint32_t ncodes;
+    uint64_t *codes;
+    uint32_t d;
+
+    // reads codes of the families' geometry.
+    quad_sample_code_t sample_code;
+
+    pthread_mutex_t mutex; // protects refcount
+    int refcount;
+
+    enum apriltag_decoder decoder;
+    int maxhamming;
+    uint32_t nentries;
+
+    // rotate_lut[k][v] is rotate90() of byte v at byte offset k.
+    int rotate_nbytes;
+    uint64_t (*rotate_lut)[256];
+
+    // APRILTAG_DECODER_MULTI_INDEX
+    int nsubstrings;
+    struct quick_decode_substring *substrings;
+
+    // APRILTAG_DECODER_TABLE
+
+    // rotcodes[ridx*ncodes + id] is the code that, after ridx calls
+    // to rotate90(), becomes codes[id].
+    uint64_t *rotcodes;
+
+    uint32_t nbuckets;   // a power of two
+    int bucket_bits;     // log2(nbuckets)
+    uint64_t *slots;     // nbuckets * QUICK_DECODE_BUCKET_SLOTS, 64-byte aligned
+    void *alloc;         // backs slots
+
+    // number of buckets touched when looking up each entry
+    uint64_t probe_sum;
+    int probe_max;
+
+    // For an index loaded with apriltag_decode_index_load(), the
+    // read-only mapping of the file. slots, rotcodes and the
+    // substrings' offsets and ids point into it.
+    void *map;
+    size_t map_size;
 };
 
+static inline uint64_t quick_decode_hash(uint64_t code)
+{
+    return code * 0x9e3779b97f4a7c15ULL;
+}
+
+// the bits of the hash below the bucket index, with the lowest bit
+// forced so that no occupied slot is 0.
+static inline uint64_t quick_decode_fingerprint(const struct apriltag_decode_index *qd, uint64_t h)
+{
+    return ((h << qd->bucket_bits) & ~QUICK_DECODE_PAYLOAD_MASK) | (QUICK_DECODE_PAYLOAD_MASK + 1);
+}
+
 /** if the bits in w were arranged in a d*d grid and that grid was
  * rotated, what would the new bits in w be?
  * The bits are organized like this (for d = 3):
@@ -152,201 +276,825 @@ static uint64_t rotate90(uint64_t w, uint32_t d)
     return wr;
 }
 
-void quad_destroy(struct quad *quad)
+// rotate90() by table lookup, one byte of w at a time.
+static inline uint64_t quick_decode_rotate90(const struct apriltag_decode_index *qd, uint64_t w)
 {
-    if (!quad)
-        return;
+    uint64_t wr = 0;
 
-    matd_destroy(quad->H);
-    matd_destroy(quad->Hinv);
-    free(quad);
-}
+    for (int k = 0; k < qd->rotate_nbytes; k++)
+        wr |= qd->rotate_lut[k][(w >> (8*k)) & 0xff];
 
-struct quad *quad_copy(struct quad *quad)
-{
-    struct quad *q = calloc(1, sizeof(struct quad));
-    memcpy(q, quad, sizeof(struct quad));
-    if (quad->H)
-        q->H = matd_copy(quad->H);
-    if (quad->Hinv)
-        q->Hinv = matd_copy(quad->Hinv);
-    return q;
+    return wr;
 }
 
-void quick_decode_add(struct quick_decode *qd, uint64_t code, int id, int hamming)
+void quick_decode_add(struct apriltag_decode_index *qd, uint64_t code, int id, int rotation)
 {
-    uint32_t bucket = code % qd->nentries;
+    uint64_t h = quick_decode_hash(code);
+    uint64_t slot = quick_decode_fingerprint(qd, h) |
+        ((uint64_t) rotation << QUICK_DECODE_ROTATION_SHIFT) | id;
+    uint32_t bucket = h >> (64 - qd->bucket_bits);
+
+    for (int nprobes = 1; ; nprobes++) {
+        uint64_t *slots = &qd->slots[bucket * QUICK_DECODE_BUCKET_SLOTS];
+
+        for (int i = 0; i < QUICK_DECODE_BUCKET_SLOTS; i++) {
+            if (slots[i] == 0) {
+                slots[i] = slot;
+                qd->nentries++;
+                qd->probe_sum += nprobes;
+                qd->probe_max = imax(qd->probe_max, nprobes);
+                return;
+            }
+        }
 
-    while (qd->entries[bucket].rcode != UINT64_MAX) {
-        bucket = (bucket + 1) % qd->nentries;
+        bucket = (bucket + 1) & (qd->nbuckets - 1);
     }
-
-    qd->entries[bucket].rcode = code;
-    qd->entries[bucket].id = id;
-    qd->entries[bucket].hamming = hamming;
 }
 
-void quick_decode_uninit(apriltag_family_t *fam)
-{
-    if (!fam->impl)
-        return;
+static void quick_decode_unmap(void *map, size_t map_size);
 
-    struct quick_decode *qd = (struct quick_decode*) fam->impl;
-    free(qd->entries);
+void quick_decode_destroy(struct apriltag_decode_index *qd)
+{
+    if (qd->map) {
+        quick_decode_unmap(qd->map, qd->map_size);
+    } else {
+        for (int i = 0; i < qd->nsubstrings; i++) {
+            free(qd->substrings[i].offsets);
+            free(qd->substrings[i].ids);
+        }
+        free(qd->rotcodes);
+        free(qd->alloc);
+    }
+    free(qd->substrings);
+    free(qd->rotate_lut);
+    free(qd->families);
+    free(qd->code_base);
+    free(qd->codes);
+    pthread_mutex_destroy(&qd->mutex);
     free(qd);
-    fam->impl = NULL;
 }
 
-void quick_decode_init(apriltag_family_t *family, int maxhamming)
+static void quick_decode_init_multi_index(struct apriltag_decode_index *qd)
 {
-    assert(family->impl == NULL);
-    assert(family->ncodes < 65535);
+    int nbits = qd->d * qd->d;
+
+    qd->nsubstrings = imax(qd->maxhamming + 1,
+                           (nbits + QUICK_DECODE_SUBSTRING_MAXBITS - 1) / QUICK_DECODE_SUBSTRING_MAXBITS);
+    qd->nsubstrings = imin(qd->nsubstrings, nbits);
+    qd->substrings = calloc(qd->nsubstrings, sizeof(struct quick_decode_substring));
+
+    int shift = 0;
+    for (int i = 0; i < qd->nsubstrings; i++) {
+        struct quick_decode_substring *sub = &qd->substrings[i];
+
+        // spread the remainder over the first substrings
+        int bits = nbits / qd->nsubstrings + (i < nbits % qd->nsubstrings);
+        sub->shift = shift;
+        sub->mask = (1ULL << bits) - 1;
+        shift += bits;
 
-    struct quick_decode *qd = calloc(1, sizeof(struct quick_decode));
-    int capacity = family->ncodes;
+        // counting sort of the codes by substring value
+        sub->offsets = calloc(sub->mask + 2, sizeof(uint32_t));
+        sub->ids = calloc(qd->ncodes, sizeof(uint16_t));
 
-    int nbits = family->d * family->d;
+        for (int id = 0; id < qd->ncodes; id++)
+            sub->offsets[((qd->codes[id] >> sub->shift) & sub->mask) + 1]++;
 
-    if (maxhamming >= 1)
-        capacity += family->ncodes * nbits;
+        for (uint64_t v = 0; v <= sub->mask; v++)
+            sub->offsets[v + 1] += sub->offsets[v];
 
-    if (maxhamming >= 2)
-        capacity += family->ncodes * nbits * (nbits-1);
+        for (int id = 0; id < qd->ncodes; id++) {
+            uint64_t v = (qd->codes[id] >> sub->shift) & sub->mask;
+            uint32_t pos = sub->offsets[v]++;
+            sub->ids[pos] = id;
+        }
 
-    if (maxhamming >= 3)
-        capacity += family->ncodes * nbits * (nbits-1) * (nbits-2);
+        // undo the increments above
+        for (uint64_t v = sub->mask + 1; v > 0; v--)
+            sub->offsets[v] = sub->offsets[v - 1];
+        sub->offsets[0] = 0;
 
-    qd->nentries = capacity * 3;
+        // a stored code's lookup examines every code sharing its value.
+        for (uint64_t v = 0; v <= sub->mask; v++) {
+            uint32_t n = sub->offsets[v + 1] - sub->offsets[v];
+            qd->probe_sum += (uint64_t) n * n;
+            qd->probe_max = imax(qd->probe_max, n);
+        }
+        qd->nentries += qd->ncodes;
+    }
+}
+
+static void quick_decode_init_table(struct apriltag_decode_index *qd)
+{
+    int maxhamming = qd->maxhamming;
+    int nbits = qd->d * qd->d;
+
+    // number of codewords within maxhamming of each code
+    uint64_t capacity = 4;
+    uint64_t nchoosek = 1;
+    for (int k = 1; k <= maxhamming; k++) {
+        nchoosek = nchoosek * (nbits - k + 1) / k;
+        capacity += 4 * nchoosek;
+    }
+    capacity *= qd->ncodes;
 
-//    printf("capacity %d, size: %.0f kB\n",
-//           capacity, qd->nentries * sizeof(struct quick_decode_entry) / 1024.0);
+    // keep the load factor at or below 3/4.
+    qd->bucket_bits = 4;
+    while (((uint64_t) QUICK_DECODE_BUCKET_SLOTS << qd->bucket_bits) * 3 < capacity * 4)
+        qd->bucket_bits++;
+    qd->nbuckets = 1 << qd->bucket_bits;
 
-    qd->entries = calloc(qd->nentries, sizeof(struct quick_decode_entry));
-    if (qd->entries == NULL) {
+    size_t nbytes = (size_t) qd->nbuckets * QUICK_DECODE_BUCKET_SLOTS * sizeof(uint64_t);
+    qd->alloc = calloc(1, nbytes + 64);
+    if (qd->alloc == NULL) {
         printf("apriltag.c: failed to allocate hamming decode table. Reduce max hamming size.\n");
         exit(-1);
     }
+    qd->slots = (uint64_t*) (((uintptr_t) qd->alloc + 63) & ~(uintptr_t) 63);
+
+    // a code that becomes codes[id] after ridx rotations is codes[id]
+    // rotated another 4-ridx times.
+    qd->rotcodes = calloc(4 * qd->ncodes, sizeof(uint64_t));
+    for (int i = 0; i < qd->ncodes; i++) {
+        uint64_t code = qd->codes[i];
+        for (int ridx = 0; ridx < 4; ridx++) {
+            qd->rotcodes[((4 - ridx) & 3) * qd->ncodes + i] = code;
+            code = quick_decode_rotate90(qd, code);
+        }
+    }
 
-    for (int i = 0; i < qd->nentries; i++)
-        qd->entries[i].rcode = UINT64_MAX;
+    // Entries are added in order of rotation, then id, so that a
+    // codeword reachable from several codes decodes as the first
+    // rotation that matches, as when the rotations were tried in turn.
+    for (int ridx = 0; ridx < 4; ridx++) {
+        for (int i = 0; i < qd->ncodes; i++) {
+            uint64_t code = qd->rotcodes[ridx * qd->ncodes + i];
 
-    for (int i = 0; i < family->ncodes; i++) {
-        uint64_t code = family->codes[i];
+            // add exact code (hamming = 0)
+            quick_decode_add(qd, code, i, ridx);
 
-        // add exact code (hamming = 0)
-        quick_decode_add(qd, code, i, 0);
+            if (maxhamming >= 1) {
+                // add hamming 1
+                for (int j = 0; j < nbits; j++)
+                    quick_decode_add(qd, code ^ (1ULL << j), i, ridx);
+            }
 
-        if (maxhamming >= 1) {
-            // add hamming 1
-            for (int j = 0; j < nbits; j++)
-                quick_decode_add(qd, code ^ (1L << j), i, 1);
-        }
+            if (maxhamming >= 2) {
+                // add hamming 2
+                for (int j = 0; j < nbits; j++)
+                    for (int k = 0; k < j; k++)
+                        quick_decode_add(qd, code ^ (1ULL << j) ^ (1ULL << k), i, ridx);
+            }
 
-        if (maxhamming >= 2) {
-            // add hamming 2
-            for (int j = 0; j < nbits; j++)
-                for (int k = 0; k < j; k++)
-                    quick_decode_add(qd, code ^ (1L << j) ^ (1L << k), i, 2);
+            if (maxhamming >= 3) {
+                // add hamming 3
+                for (int j = 0; j < nbits; j++)
+                    for (int k = 0; k < j; k++)
+                        for (int m = 0; m < k; m++)
+                            quick_decode_add(qd, code ^ (1ULL << j) ^ (1ULL << k) ^ (1ULL << m), i, ridx);
+            }
         }
+    }
+}
 
-        if (maxhamming >= 3) {
-            // add hamming 3
-            for (int j = 0; j < nbits; j++)
-                for (int k = 0; k < j; k++)
-                    for (int m = 0; m < k; m++)
-                        quick_decode_add(qd, code ^ (1L << j) ^ (1L << k) ^ (1L << m), i, 3);
-        }
+// an index with no codes added yet, or NULL if the families cannot
+// share one.
+static struct apriltag_decode_index *quick_decode_alloc(const apriltag_family_t *const *families, int nfamilies,
+                                                        int maxhamming, enum apriltag_decoder decoder)
+{
+    if (nfamilies < 1)
+        return NULL;
+
+    uint32_t ncodes = 0;
+    for (int f = 0; f < nfamilies; f++) {
+        if (families[f]->d != families[0]->d || families[f]->black_border != families[0]->black_border)
+            return NULL;
+        ncodes += families[f]->ncodes;
+    }
 
-        if (maxhamming > 3) {
-            printf("apriltag.c: maxhamming beyond 3 not supported\n");
-        }
+    if (ncodes >= 65535)
+        return NULL;
+
+    struct apriltag_decode_index *qd = calloc(1, sizeof(struct apriltag_decode_index));
+    pthread_mutex_init(&qd->mutex, NULL);
+    qd->refcount = 1;
+    qd->decoder = decoder;
+    qd->maxhamming = maxhamming;
+
+    qd->nfamilies = nfamilies;
+    qd->families = calloc(nfamilies, sizeof(apriltag_family_t*));
+    memcpy(qd->families, families, nfamilies * sizeof(apriltag_family_t*));
+    qd->code_base = calloc(nfamilies + 1, sizeof(uint32_t));
+    qd->ncodes = ncodes;
+    qd->codes = calloc(ncodes, sizeof(uint64_t));
+    qd->d = families[0]->d;
+    qd->sample_code = quad_sample_code_kernel(families[0]->d, families[0]->black_border);
+
+    for (int f = 0; f < nfamilies; f++) {
+        qd->code_base[f + 1] = qd->code_base[f] + families[f]->ncodes;
+        memcpy(&qd->codes[qd->code_base[f]], families[f]->codes, families[f]->ncodes * sizeof(uint64_t));
+    }
+
+    int nbits = qd->d * qd->d;
+    qd->rotate_nbytes = (nbits + 7) / 8;
+    qd->rotate_lut = calloc(qd->rotate_nbytes, sizeof(*qd->rotate_lut));
+    for (int k = 0; k < qd->rotate_nbytes; k++)
+        for (int v = 0; v < 256; v++)
+            qd->rotate_lut[k][v] = rotate90((uint64_t) v << (8*k), qd->d);
+
+    return qd;
+}
+
+struct apriltag_decode_index *quick_decode_create(const apriltag_family_t *const *families, int nfamilies,
+                                                  int maxhamming, enum apriltag_decoder decoder)
+{
+    if (decoder == APRILTAG_DECODER_AUTO)
+        decoder = maxhamming <= 2 ? APRILTAG_DECODER_TABLE : APRILTAG_DECODER_MULTI_INDEX;
+
+    if (decoder == APRILTAG_DECODER_TABLE && maxhamming > 3) {
+        printf("apriltag.c: maxhamming beyond 3 not supported by the table decoder\n");
+        maxhamming = 3;
     }
 
-    family->impl = qd;
+    struct apriltag_decode_index *qd = quick_decode_alloc(families, nfamilies, maxhamming, decoder);
+    if (qd == NULL)
+        return NULL;
+
+    if (decoder == APRILTAG_DECODER_TABLE)
+        quick_decode_init_table(qd);
+    else
+        quick_decode_init_multi_index(qd);
+
+    return qd;
+}
+
+// returns the id of the closest code within maxhamming of rcode
+// (lowest id on ties), or -1.
+static inline int quick_decode_lookup_multi_index(const struct apriltag_decode_index *qd,
+                                                  uint64_t rcode, int *hamming)
+{
+    int best_id = -1, best_hamming = qd->maxhamming + 1;
+
+    for (int i = 0; i < qd->nsubstrings; i++) {
+        const struct quick_decode_substring *sub = &qd->substrings[i];
+        uint64_t v = (rcode >> sub->shift) & sub->mask;
+
+        for (uint32_t j = sub->offsets[v]; j < sub->offsets[v + 1]; j++) {
+            int id = sub->ids[j];
+            int hd = popcount64(rcode ^ qd->codes[id]);
+
+            if (hd < best_hamming || (hd == best_hamming && id < best_id)) {
+                best_id = id;
+                best_hamming = hd;
+            }
+        }
 
-    if (0) {
-        int longest_run = 0;
-        int run = 0;
-        int run_sum = 0;
-        int run_count = 0;
+        if (best_hamming == 0)
+            break;
+    }
 
-        // This accounting code doesn't check the last possible run that
-        // occurs at the wrap-around. That's pretty insignificant.
-        for (int i = 0; i < qd->nentries; i++) {
-            if (qd->entries[i].rcode == UINT64_MAX) {
-                if (run > 0) {
-                    run_sum += run;
-                    run_count ++;
+    *hamming = best_hamming;
+    return best_id;
+}
+
+// returns the id of the code within maxhamming of a rotation of
+// rcode, or -1.
+static inline int quick_decode_lookup(const struct apriltag_decode_index *qd,
+                                      uint64_t rcode, int *hamming, int *rotation)
+{
+    uint64_t h = quick_decode_hash(rcode);
+    uint64_t fp = quick_decode_fingerprint(qd, h);
+    uint32_t bucket = h >> (64 - qd->bucket_bits);
+
+    while (1) {
+        const uint64_t *slots = &qd->slots[bucket * QUICK_DECODE_BUCKET_SLOTS];
+
+        for (int i = 0; i < QUICK_DECODE_BUCKET_SLOTS; i++) {
+            uint64_t slot = slots[i];
+            if (slot == 0)
+                return -1;
+
+            if ((slot & ~QUICK_DECODE_PAYLOAD_MASK) == fp) {
+                int id = slot & QUICK_DECODE_ID_MASK;
+                int ridx = (slot >> QUICK_DECODE_ROTATION_SHIFT) & 3;
+                int hd = popcount64(rcode ^ qd->rotcodes[ridx * qd->ncodes + id]);
+                if (hd <= qd->maxhamming) {
+                    *hamming = hd;
+                    *rotation = ridx;
+                    return id;
                 }
-                run = 0;
-            } else {
-                run ++;
-                longest_run = imax(longest_run, run);
             }
         }
 
-        printf("quick decode: longest run: %d, average run %.3f\n", longest_run, 1.0 * run_sum / run_count);
+        bucket = (bucket + 1) & (qd->nbuckets - 1);
     }
 }
 
+static void quick_decode_set_entry(const struct apriltag_decode_index *qd, struct quick_decode_entry *entry,
+                                   uint64_t rcode, int id, int hamming, int rotation)
+{
+    int f = 0;
+    while (id >= qd->code_base[f + 1])
+        f++;
+
+    entry->rcode = rcode;
+    entry->family = qd->families[f];
+    entry->id = id - qd->code_base[f];
+    entry->hamming = hamming;
+    entry->rotation = rotation;
+}
+
 // returns an entry with hamming set to 255 if no decode was found.
-static void quick_decode_codeword(apriltag_family_t *tf, uint64_t rcode,
+static void quick_decode_codeword(const struct apriltag_decode_index *qd, uint64_t rcode,
                                   struct quick_decode_entry *entry)
 {
-    struct quick_decode *qd = (struct quick_decode*) tf->impl;
+    if (qd->decoder == APRILTAG_DECODER_TABLE) {
+        int hamming, rotation;
+        int id = quick_decode_lookup(qd, rcode, &hamming, &rotation);
 
-    for (int ridx = 0; ridx < 4; ridx++) {
-
-        for (int bucket = rcode % qd->nentries;
-             qd->entries[bucket].rcode != UINT64_MAX;
-             bucket = (bucket + 1) % qd->nentries) {
+        if (id >= 0) {
+            quick_decode_set_entry(qd, entry, rcode, id, hamming, rotation);
+            return;
+        }
+    } else {
+        for (int ridx = 0; ridx < 4; ridx++) {
+            int hamming;
+            int id = quick_decode_lookup_multi_index(qd, rcode, &hamming);
 
-            if (qd->entries[bucket].rcode == rcode) {
-                *entry = qd->entries[bucket];
-                entry->rotation = ridx;
+            if (id >= 0) {
+                quick_decode_set_entry(qd, entry, rcode, id, hamming, ridx);
                 return;
             }
-        }
 
-        rcode = rotate90(rcode, tf->d);
+            rcode = quick_decode_rotate90(qd, rcode);
+        }
     }
 
     entry->rcode = 0;
+    entry->family = NULL;
     entry->id = 65535;
     entry->hamming = 255;
     entry->rotation = 0;
 }
 
-static inline int detection_compare_function(const void *_a, const void *_b)
+// returns the hamming distance from any rotation of rcode to the
+// nearest code of the index, by exhaustive search. Unlike
+// quick_decode_codeword(), this is not limited to maxhamming.
+static int quick_decode_nearest_hamming(const struct apriltag_decode_index *qd, uint64_t rcode)
+{
+    int best_hamming = 64;
+
+    for (int ridx = 0; ridx < 4; ridx++) {
+        for (uint32_t id = 0; id < qd->ncodes; id++)
+            best_hamming = imin(best_hamming, popcount64(rcode ^ qd->codes[id]));
+
+        rcode = quick_decode_rotate90(qd, rcode);
+    }
+
+    return best_hamming;
+}
+
+apriltag_decode_index_t *apriltag_decode_index_create_families(const apriltag_family_t *const *fams, int nfams,
+                                                               int bits_corrected, enum apriltag_decoder decoder)
+{
+    return quick_decode_create(fams, nfams, bits_corrected, decoder);
+}
+
+apriltag_decode_index_t *apriltag_decode_index_create(const apriltag_family_t *fam, int bits_corrected,
+                                                      enum apriltag_decoder decoder)
+{
+    return quick_decode_create(&fam, 1, bits_corrected, decoder);
+}
+
+apriltag_decode_index_t *apriltag_decode_index_retain(apriltag_decode_index_t *index)
+{
+    pthread_mutex_lock(&index->mutex);
+    index->refcount++;
+    pthread_mutex_unlock(&index->mutex);
+
+    return index;
+}
+
+void apriltag_decode_index_release(apriltag_decode_index_t *index)
+{
+    pthread_mutex_lock(&index->mutex);
+    int refcount = --index->refcount;
+    pthread_mutex_unlock(&index->mutex);
+
+    if (refcount == 0)
+        quick_decode_destroy(index);
+}
+
+int apriltag_decode_index_get_nfamilies(const apriltag_decode_index_t *index)
+{
+    return index->nfamilies;
+}
+
+const apriltag_family_t *apriltag_decode_index_get_family(const apriltag_decode_index_t *index, int idx)
+{
+    assert(idx >= 0 && idx < index->nfamilies);
+    return index->families[idx];
+}
+
+int apriltag_decode_index_decode(const apriltag_decode_index_t *index, uint64_t rcode,
+                                 const apriltag_family_t **family, int *hamming, int *rotation)
+{
+    struct quick_decode_entry entry;
+    quick_decode_codeword(index, rcode, &entry);
+
+    if (entry.hamming == 255)
+        return -1;
+
+    *family = entry.family;
+    *hamming = entry.hamming;
+    *rotation = entry.rotation;
+    return entry.id;
+}
+
+void apriltag_decode_index_get_info(const apriltag_decode_index_t *qd,
+                                    struct apriltag_decode_index_info *info)
+{
+    info->decoder = qd->decoder;
+    info->maxhamming = qd->maxhamming;
+    info->nentries = qd->nentries;
+
+    if (qd->decoder == APRILTAG_DECODER_TABLE) {
+        info->capacity = qd->nbuckets * QUICK_DECODE_BUCKET_SLOTS;
+        info->nbytes = (size_t) info->capacity * sizeof(uint64_t) + 4 * qd->ncodes * sizeof(uint64_t);
+    } else {
+        info->capacity = qd->nentries;
+        info->nbytes = 0;
+        for (int i = 0; i < qd->nsubstrings; i++)
+            info->nbytes += (qd->substrings[i].mask + 2) * sizeof(uint32_t) + qd->ncodes * sizeof(uint16_t);
+    }
+    info->avg_probe_length = qd->nentries ? (double) qd->probe_sum / qd->nentries : 0;
+    info->max_probe_length = qd->probe_max;
+}
+
+// On-disk layout of a decode index: a header followed by the arrays
+// of the index, each starting on a 64-byte boundary so that the
+// table's buckets stay cache-line aligned when the file is mapped.
+// All values are in the byte order of the writer; byte_order detects
+// a mismatch.
+#define DECODE_INDEX_MAGIC   "ATDECIDX"
+#define DECODE_INDEX_VERSION 2
+#define DECODE_INDEX_ALIGN   64
+
+struct decode_index_header
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;  // 0x01020304
+
+    // the families the index was built for
+    uint64_t codes_hash;
+    uint32_t nfamilies;
+    uint32_t ncodes;
+    uint32_t d;
+    uint32_t reserved0;
+
+    uint32_t decoder;
+    uint32_t maxhamming;
+    uint32_t nentries;
+    uint32_t probe_max;
+    uint64_t probe_sum;
+
+    // APRILTAG_DECODER_TABLE
+    uint32_t bucket_bits;
+    uint32_t reserved;
+    uint64_t slots_offset;
+    uint64_t rotcodes_offset;
+
+    // APRILTAG_DECODER_MULTI_INDEX: nsubstrings decode_index_substring
+    uint32_t nsubstrings;
+    uint32_t reserved2;
+    uint64_t substrings_offset;
+
+    uint64_t file_size;
+};
+
+struct decode_index_substring
+{
+    uint32_t shift;
+    uint32_t bits;
+    uint64_t offsets_offset;
+    uint64_t ids_offset;
+};
+
+static uint64_t decode_index_fnv(uint64_t h, uint64_t v)
+{
+    for (int b = 0; b < 8; b++) {
+        h ^= (v >> (8*b)) & 0xff;
+        h *= 0x100000001b3ULL;
+    }
+    return h;
+}
+
+// FNV-1a over the families' codes and the boundaries between them.
+static uint64_t decode_index_codes_hash(const struct apriltag_decode_index *qd)
+{
+    uint64_t h = 0xcbf29ce484222325ULL;
+
+    for (int f = 0; f <= qd->nfamilies; f++)
+        h = decode_index_fnv(h, qd->code_base[f]);
+
+    for (int i = 0; i < qd->ncodes; i++)
+        h = decode_index_fnv(h, qd->codes[i]);
+
+    return h;
+}
+
+static uint64_t decode_index_align(uint64_t offset)
+{
+    return (offset + DECODE_INDEX_ALIGN - 1) & ~(uint64_t) (DECODE_INDEX_ALIGN - 1);
+}
+
+// writes n bytes at offset, zero-filling from *pos.
+static int decode_index_write(FILE *f, uint64_t *pos, uint64_t offset, const void *p, size_t n)
+{
+    static const char zeros[DECODE_INDEX_ALIGN];
+
+    assert(offset >= *pos && offset - *pos <= DECODE_INDEX_ALIGN);
+    if (fwrite(zeros, 1, offset - *pos, f) != offset - *pos || fwrite(p, 1, n, f) != n)
+        return -1;
+
+    *pos = offset + n;
+    return 0;
+}
+
+int apriltag_decode_index_save(const apriltag_decode_index_t *qd, const char *path)
+{
+    struct decode_index_header hdr;
+    memset(&hdr, 0, sizeof(hdr));
+    memcpy(hdr.magic, DECODE_INDEX_MAGIC, sizeof(hdr.magic));
+    hdr.version = DECODE_INDEX_VERSION;
+    hdr.byte_order = 0x01020304;
+    hdr.codes_hash = decode_index_codes_hash(qd);
+    hdr.nfamilies = qd->nfamilies;
+    hdr.ncodes = qd->ncodes;
+    hdr.d = qd->d;
+    hdr.decoder = qd->decoder;
+    hdr.maxhamming = qd->maxhamming;
+    hdr.nentries = qd->nentries;
+    hdr.probe_max = qd->probe_max;
+    hdr.probe_sum = qd->probe_sum;
+
+    // lay out the sections
+    uint64_t offset = sizeof(hdr);
+    size_t slots_size = (size_t) qd->nbuckets * QUICK_DECODE_BUCKET_SLOTS * sizeof(uint64_t);
+    size_t rotcodes_size = 4 * qd->ncodes * sizeof(uint64_t);
+
+    struct decode_index_substring *subs = calloc(qd->nsubstrings + 1, sizeof(struct decode_index_substring));
+
+    if (qd->decoder == APRILTAG_DECODER_TABLE) {
+        hdr.bucket_bits = qd->bucket_bits;
+        hdr.slots_offset = decode_index_align(offset);
+        offset = hdr.slots_offset + slots_size;
+        hdr.rotcodes_offset = decode_index_align(offset);
+        offset = hdr.rotcodes_offset + rotcodes_size;
+    } else {
+        hdr.nsubstrings = qd->nsubstrings;
+        hdr.substrings_offset = decode_index_align(offset);
+        offset = hdr.substrings_offset + qd->nsubstrings * sizeof(struct decode_index_substring);
+
+        for (int i = 0; i < qd->nsubstrings; i++) {
+            const struct quick_decode_substring *sub = &qd->substrings[i];
+            subs[i].shift = sub->shift;
+            subs[i].bits = popcount64(sub->mask);
+            subs[i].offsets_offset = decode_index_align(offset);
+            offset = subs[i].offsets_offset + (sub->mask + 2) * sizeof(uint32_t);
+            subs[i].ids_offset = decode_index_align(offset);
+            offset = subs[i].ids_offset + qd->ncodes * sizeof(uint16_t);
+        }
+    }
+    hdr.file_size = offset;
+
+    FILE *f = fopen(path, "wb");
+    if (f == NULL) {
+        free(subs);
+        return -1;
+    }
+
+    uint64_t pos = 0;
+    int res = decode_index_write(f, &pos, 0, &hdr, sizeof(hdr));
+
+    if (qd->decoder == APRILTAG_DECODER_TABLE) {
+        res |= decode_index_write(f, &pos, hdr.slots_offset, qd->slots, slots_size);
+        res |= decode_index_write(f, &pos, hdr.rotcodes_offset, qd->rotcodes, rotcodes_size);
+    } else {
+        res |= decode_index_write(f, &pos, hdr.substrings_offset, subs,
+                                  qd->nsubstrings * sizeof(struct decode_index_substring));
+        for (int i = 0; i < qd->nsubstrings; i++) {
+            const struct quick_decode_substring *sub = &qd->substrings[i];
+            res |= decode_index_write(f, &pos, subs[i].offsets_offset, sub->offsets,
+                                      (sub->mask + 2) * sizeof(uint32_t));
+            res |= decode_index_write(f, &pos, subs[i].ids_offset, sub->ids,
+                                      qd->ncodes * sizeof(uint16_t));
+        }
+    }
+
+    free(subs);
+
+    if (fclose(f))
+        res = -1;
+
+    return res ? -1 : 0;
+}
+
+// maps the whole file read-only, or returns NULL.
+static void *quick_decode_map(const char *path, size_t *map_size)
+{
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+        return NULL;
+
+    LARGE_INTEGER size;
+    void *map = NULL;
+    if (GetFileSizeEx(file, &size) && size.QuadPart > 0) {
+        HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (mapping != NULL) {
+            map = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            CloseHandle(mapping);
+        }
+        *map_size = (size_t) size.QuadPart;
+    }
+    CloseHandle(file);
+    return map;
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return NULL;
+
+    struct stat st;
+    void *map = NULL;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        if (map == MAP_FAILED)
+            map = NULL;
+        *map_size = st.st_size;
+    }
+    close(fd);
+    return map;
+#endif
+}
+
+static void quick_decode_unmap(void *map, size_t map_size)
+{
+#ifdef _WIN32
+    UnmapViewOfFile(map);
+#else
+    munmap(map, map_size);
+#endif
+}
+
+// is [offset, offset+n) inside the file and suitably aligned?
+static int decode_index_section_ok(const struct decode_index_header *hdr, uint64_t offset, uint64_t n)
+{
+    return offset % DECODE_INDEX_ALIGN == 0 && offset <= hdr->file_size && n <= hdr->file_size - offset;
+}
+
+apriltag_decode_index_t *apriltag_decode_index_load_families(const apriltag_family_t *const *fams, int nfams,
+                                                             const char *path)
+{
+    size_t map_size;
+    void *map = quick_decode_map(path, &map_size);
+    if (map == NULL)
+        return NULL;
+
+    const struct decode_index_header *hdr = map;
+
+    if (map_size < sizeof(*hdr) ||
+        memcmp(hdr->magic, DECODE_INDEX_MAGIC, sizeof(hdr->magic)) ||
+        hdr->version != DECODE_INDEX_VERSION ||
+        hdr->byte_order != 0x01020304 ||
+        hdr->file_size != map_size ||
+        (hdr->decoder != APRILTAG_DECODER_TABLE && hdr->decoder != APRILTAG_DECODER_MULTI_INDEX))
+        goto fail;
+
+    struct apriltag_decode_index *qd = quick_decode_alloc(fams, nfams, hdr->maxhamming, hdr->decoder);
+    if (qd == NULL)
+        goto fail;
+
+    qd->map = map;
+    qd->map_size = map_size;
+
+    if (hdr->nfamilies != qd->nfamilies || hdr->ncodes != qd->ncodes || hdr->d != qd->d ||
+        hdr->codes_hash != decode_index_codes_hash(qd))
+        goto fail_qd;
+
+    qd->nentries = hdr->nentries;
+    qd->probe_max = hdr->probe_max;
+    qd->probe_sum = hdr->probe_sum;
+
+    if (qd->decoder == APRILTAG_DECODER_TABLE) {
+        if (hdr->bucket_bits < 4 || hdr->bucket_bits > 31 ||
+            !decode_index_section_ok(hdr, hdr->slots_offset,
+                                     ((uint64_t) QUICK_DECODE_BUCKET_SLOTS << hdr->bucket_bits) * sizeof(uint64_t)) ||
+            !decode_index_section_ok(hdr, hdr->rotcodes_offset, 4 * qd->ncodes * sizeof(uint64_t)))
+            goto fail_qd;
+
+        qd->bucket_bits = hdr->bucket_bits;
+        qd->nbuckets = 1 << qd->bucket_bits;
+        qd->slots = (uint64_t*) ((char*) map + hdr->slots_offset);
+        qd->rotcodes = (uint64_t*) ((char*) map + hdr->rotcodes_offset);
+    } else {
+        if (hdr->nsubstrings == 0 || hdr->nsubstrings > 64 ||
+            !decode_index_section_ok(hdr, hdr->substrings_offset,
+                                     hdr->nsubstrings * sizeof(struct decode_index_substring)))
+            goto fail_qd;
+
+        const struct decode_index_substring *subs =
+            (const struct decode_index_substring*) ((char*) map + hdr->substrings_offset);
+
+        qd->substrings = calloc(hdr->nsubstrings, sizeof(struct quick_decode_substring));
+        qd->nsubstrings = hdr->nsubstrings;
+
+        for (int i = 0; i < qd->nsubstrings; i++) {
+            struct quick_decode_substring *sub = &qd->substrings[i];
+            if (subs[i].bits == 0 || subs[i].bits > QUICK_DECODE_SUBSTRING_MAXBITS ||
+                subs[i].shift + subs[i].bits > qd->d * qd->d ||
+                !decode_index_section_ok(hdr, subs[i].offsets_offset,
+                                         ((1ULL << subs[i].bits) + 1) * sizeof(uint32_t)) ||
+                !decode_index_section_ok(hdr, subs[i].ids_offset, qd->ncodes * sizeof(uint16_t)))
+                goto fail_qd;
+
+            sub->shift = subs[i].shift;
+            sub->mask = (1ULL << subs[i].bits) - 1;
+            sub->offsets = (uint32_t*) ((char*) map + subs[i].offsets_offset);
+            sub->ids = (uint16_t*) ((char*) map + subs[i].ids_offset);
+        }
+    }
+
+    return qd;
+
+  fail_qd:
+    quick_decode_destroy(qd);
+    return NULL;
+
+  fail:
+    quick_decode_unmap(map, map_size);
+    return NULL;
+}
+
+apriltag_decode_index_t *apriltag_decode_index_load(const apriltag_family_t *fam, const char *path)
 {
-    apriltag_detection_t *a = *(apriltag_detection_t**) _a;
-    apriltag_detection_t *b = *(apriltag_detection_t**) _b;
+    return apriltag_decode_index_load_families(&fam, 1, path);
+}
+
+void apriltag_detector_remove_family(apriltag_detector_t *td, const apriltag_family_t *fam)
+{
+    int idx = zarray_index_of(td->tag_families, &fam);
+    if (idx < 0)
+        return;
 
-    return a->id - b->id;
+    apriltag_decode_index_t *index;
+    zarray_get(td->decode_indexes, idx, &index);
+    apriltag_decode_index_release(index);
+
+    zarray_remove_index(td->tag_families, idx, 0);
+    zarray_remove_index(td->decode_indexes, idx, 0);
 }
 
-void apriltag_detector_remove_family(apriltag_detector_t *td, apriltag_family_t *fam)
+void apriltag_detector_add_family_index(apriltag_detector_t *td, apriltag_decode_index_t *index)
 {
-    quick_decode_uninit(fam);
-    zarray_remove_value(td->tag_families, &fam, 0);
+    for (int f = 0; f < index->nfamilies; f++) {
+        apriltag_decode_index_retain(index);
+
+        zarray_add(td->tag_families, &index->families[f]);
+        zarray_add(td->decode_indexes, &index);
+    }
 }
 
-void apriltag_detector_add_family_bits(apriltag_detector_t *td, apriltag_family_t *fam, int bits_corrected)
+int apriltag_detector_add_family_decoder(apriltag_detector_t *td, const apriltag_family_t *fam,
+                                         int bits_corrected, enum apriltag_decoder decoder)
 {
-    zarray_add(td->tag_families, &fam);
+    apriltag_decode_index_t *index = apriltag_decode_index_create(fam, bits_corrected, decoder);
+    if (index == NULL) {
+        printf("apriltag.c: failed to build the decode index of a family; it was not added.\n");
+        return -1;
+    }
 
-    if (!fam->impl)
-        quick_decode_init(fam, bits_corrected);
+    apriltag_detector_add_family_index(td, index);
+    apriltag_decode_index_release(index);
+    return 0;
+}
+
+void apriltag_detector_add_family_bits(apriltag_detector_t *td, const apriltag_family_t *fam, int bits_corrected)
+{
+    apriltag_detector_add_family_decoder(td, fam, bits_corrected, APRILTAG_DECODER_AUTO);
 }
 
 void apriltag_detector_clear_families(apriltag_detector_t *td)
 {
-    for (int i = 0; i < zarray_size(td->tag_families); i++) {
-        apriltag_family_t *fam;
-        zarray_get(td->tag_families, i, &fam);
-        quick_decode_uninit(fam);
+    for (int i = 0; i < zarray_size(td->decode_indexes); i++) {
+        apriltag_decode_index_t *index;
+        zarray_get(td->decode_indexes, i, &index);
+        apriltag_decode_index_release(index);
     }
     zarray_clear(td->tag_families);
+    zarray_clear(td->decode_indexes);
 }
 
 apriltag_detector_t *apriltag_detector_create()
@@ -364,8 +1112,13 @@ apriltag_detector_t *apriltag_detector_create()
     td->qtp.critical_rad = 10 * M_PI / 180;
     td->qtp.deglitch = 0;
     td->qtp.min_white_black_diff = 5;
+    td->qtp.segment_mode = APRILTAG_SEGMENT_MAXIMA;
 
     td->tag_families = zarray_create(sizeof(apriltag_family_t*));
+    td->decode_indexes = zarray_create(sizeof(apriltag_decode_index_t*));
+
+    td->task_detections = zarray_create(sizeof(zarray_t*));
+    td->reconcile_entries = NULL; // created on first use
 
     pthread_mutex_init(&td->mutex, NULL);
 
@@ -373,6 +1126,11 @@ apriltag_detector_t *apriltag_detector_create()
 
     td->refine_edges = 1;
     td->refine_pose = 0;
+    td->refine_pose_mode = APRILTAG_REFINE_POSE_HILL_CLIMB;
+    td->decode_sampling = APRILTAG_DECODE_SAMPLING_NEAREST;
+    td->min_decision_margin = 0;
+    td->decode_early_reject = 0;
+    td->decode_first = 0;
     td->refine_decode = 0;
 
     td->debug = 0;
@@ -391,6 +1149,18 @@ void apriltag_detector_destroy(apriltag_detector_t *td)
     apriltag_detector_clear_families(td);
 
     zarray_destroy(td->tag_families);
+    zarray_destroy(td->decode_indexes);
+
+    for (int i = 0; i < zarray_size(td->task_detections); i++) {
+        zarray_t *detections;
+        zarray_get(td->task_detections, i, &detections);
+        zarray_destroy(detections);
+    }
+    zarray_destroy(td->task_detections);
+
+    if (td->reconcile_entries)
+        zarray_destroy(td->reconcile_entries);
+
     free(td);
 }
 
@@ -401,8 +1171,22 @@ struct quad_decode_task
     apriltag_detector_t *td;
 
     image_u8_t *im;
+
+    // struct decode_group, shared by all tasks
+    zarray_t *groups;
+
+    // apriltag_detection_t produced by this task; merged in task order
+    // by the caller so that no locking is needed.
     zarray_t *detections;
 
+    // accumulated privately and summed by the caller.
+    uint32_t nhomography_failed;
+    uint32_t nborder_rejected;
+    uint32_t nmargin_rejected;
+    uint32_t ndecode_failed;
+    uint32_t nrefine_pose;
+    uint32_t nrefine_decode;
+
     image_u8_t *im_samples;
 };
 
@@ -410,7 +1194,7 @@ struct evaluate_quad_ret
 {
     int64_t rcode;
     double  score;
-    matd_t  *H, *Hinv;
+    double  H[9], Hinv[9];
 
     int decode_status;
     struct quick_decode_entry e;
@@ -419,45 +1203,56 @@ struct evaluate_quad_ret
 // returns non-zero if an error occurs (i.e., H has no inverse)
 int quad_update_homographies(struct quad *quad)
 {
-    zarray_t *correspondences = zarray_create(sizeof(float[4]));
+    // At this stage of the pipeline, we have not attempted to decode the
+    // quad into an oriented tag. Thus, just act as if the quad is facing
+    // "up" with respect to our desired corners. We'll fix the rotation
+    // later.
+    // [-1, -1], [1, -1], [1, 1], [-1, 1]
+    double p[4][2];
 
     for (int i = 0; i < 4; i++) {
-        float corr[4];
+        p[i][0] = quad->p[i][0];
+        p[i][1] = quad->p[i][1];
+    }
 
-        // At this stage of the pipeline, we have not attempted to decode the
-        // quad into an oriented tag. Thus, just act as if the quad is facing
-        // "up" with respect to our desired corners. We'll fix the rotation
-        // later.
-        // [-1, -1], [1, -1], [1, 1], [-1, 1]
-        corr[0] = (i==0 || i==3) ? -1 : 1;
-        corr[1] = (i==0 || i==1) ? -1 : 1;
+    // With exactly four correspondences, the closed-form solution is
+    // exact, and much cheaper than homography_compute()'s SVD.
+    if (homography33_square_to_quad(p, quad->H))
+        return -1;
 
-        corr[2] = quad->p[i][0];
-        corr[3] = quad->p[i][1];
+    return homography33_inverse(quad->H, quad->Hinv);
+}
 
-        zarray_add(correspondences, &corr);
-    }
+// Finds the pixels [*x0, *x1) of a row whose centers, at height yc,
+// are inside the convex polygon p. The range is empty if *x0 >= *x1.
+static void quad_row_span(const double p[4][2], double yc, int *x0, int *x1)
+{
+    double xl = HUGE_VAL, xr = -HUGE_VAL;
 
-    if (quad->H)
-        matd_destroy(quad->H);
-    if (quad->Hinv)
-        matd_destroy(quad->Hinv);
+    for (int i = 0; i < 4; i++) {
+        const double *a = p[i], *b = p[(i + 1) & 3];
 
-    // XXX Tunable
-    quad->H = homography_compute(correspondences, HOMOGRAPHY_COMPUTE_FLAG_SVD);
-    quad->Hinv = matd_inverse(quad->H);
-    zarray_destroy(correspondences);
+        if ((a[1] <= yc && b[1] > yc) || (b[1] <= yc && a[1] > yc)) {
+            double x = a[0] + (yc - a[1]) * (b[0] - a[0]) / (b[1] - a[1]);
+            xl = fmin(xl, x);
+            xr = fmax(xr, x);
+        }
+    }
 
-    if (quad->H && quad->Hinv)
-        return 0;
+    if (xl > xr) {
+        *x0 = *x1 = 0;
+        return;
+    }
 
-    return -1;
+    // pixel x has its center at x + .5
+    *x0 = (int) ceil(xl - .5);
+    *x1 = (int) floor(xr - .5) + 1;
 }
 
 // compute a "score" for a quad that is independent of tag family
 // encoding (but dependent upon the tag geometry) by considering the
 // contrast around the exterior of the tag.
-double quad_goodness(apriltag_family_t *family, image_u8_t *im, struct quad *quad)
+double quad_goodness(const apriltag_family_t *family, image_u8_t *im, const struct quad *quad)
 {
     // when sampling from the white border, how much white border do
     // we actually consider valid, measured in bit-cell units? (the
@@ -478,7 +1273,7 @@ double quad_goodness(apriltag_family_t *family, image_u8_t *im, struct quad *qua
         double ty = (i == 0 || i == 1) ? -1 - bit_size : 1 + bit_size;
         double x, y;
 
-        homography_project(quad->H, tx, ty, &x, &y);
+        homography33_project(quad->H, tx, ty, &x, &y);
         xmin = imin(xmin, x);
         xmax = imax(xmax, x);
         ymin = imin(ymin, y);
@@ -498,24 +1293,47 @@ double quad_goodness(apriltag_family_t *family, image_u8_t *im, struct quad *qua
     float wsz = bit_size*white_border;
     float bsz = bit_size*family->black_border;
 
-    matd_t *Hinv = quad->Hinv;
-//    matd_t *H = quad->H;
+    const double *Hinv = quad->Hinv;
+
+    // Only pixels between the outer edge of the white border and the
+    // inner edge of the black border are scored. Their images, with a
+    // 1% margin, bound the pixels of each row that need to be
+    // projected; the others only have the coordinates stepped across
+    // them, which keeps the arithmetic identical.
+    double outer[4][2], inner[4][2];
+    for (int i = 0; i < 4; i++) {
+        double tx = (i == 0 || i == 3) ? -1 : 1;
+        double ty = (i == 0 || i == 1) ? -1 : 1;
+        homography33_project(quad->H, tx * (1 + wsz) * 1.01, ty * (1 + wsz) * 1.01, &outer[i][0], &outer[i][1]);
+        homography33_project(quad->H, tx * (1 - bsz) * 0.99, ty * (1 - bsz) * 0.99, &inner[i][0], &inner[i][1]);
+    }
 
     // iterate over all the pixels in the tag. (Iterating in pixel space)
     for (int y = ymin; y <= ymax; y++) {
 
+        int outer0, outer1, inner0, inner1;
+        quad_row_span(outer, y + .5, &outer0, &outer1);
+        if (bsz < 1)
+            quad_row_span(inner, y + .5, &inner0, &inner1);
+        else
+            inner0 = inner1 = 0;
+
         // we'll incrementally compute the homography
         // projections. Begin by evaluating the homogeneous position
         // [(xmin - .5f), y, 1]. Then, we'll update as we stride in
         // the +x direction.
-        double Hx = MATD_EL(Hinv, 0, 0) * (.5 + (int) xmin) +
-            MATD_EL(Hinv, 0, 1) * (y + .5) + MATD_EL(Hinv, 0, 2);
-        double Hy = MATD_EL(Hinv, 1, 0) * (.5 + (int) xmin) +
-            MATD_EL(Hinv, 1, 1) * (y + .5) + MATD_EL(Hinv, 1, 2);
-        double Hh = MATD_EL(Hinv, 2, 0) * (.5 + (int) xmin) +
-            MATD_EL(Hinv, 2, 1) * (y + .5) + MATD_EL(Hinv, 2, 2);
+        double Hx = Hinv[0] * (.5 + (int) xmin) + Hinv[1] * (y + .5) + Hinv[2];
+        double Hy = Hinv[3] * (.5 + (int) xmin) + Hinv[4] * (y + .5) + Hinv[5];
+        double Hh = Hinv[6] * (.5 + (int) xmin) + Hinv[7] * (y + .5) + Hinv[8];
 
         for (int x = xmin; x <= xmax;  x++) {
+            if (x < outer0 || x >= outer1 || (x >= inner0 && x < inner1)) {
+                Hx += Hinv[0];
+                Hy += Hinv[3];
+                Hh += Hinv[6];
+                continue;
+            }
+
             // project the pixel center.
             double tx, ty;
 
@@ -525,9 +1343,9 @@ double quad_goodness(apriltag_family_t *family, image_u8_t *im, struct quad *qua
 
             // if we move x one pixel to the right, here's what
             // happens to our three pre-normalized coordinates.
-            Hx += MATD_EL(Hinv, 0, 0);
-            Hy += MATD_EL(Hinv, 1, 0);
-            Hh += MATD_EL(Hinv, 2, 0);
+            Hx += Hinv[0];
+            Hy += Hinv[3];
+            Hh += Hinv[6];
 
             float txa = fabsf((float) tx), tya = fabsf((float) ty);
             float xymax = fmaxf(txa, tya);
@@ -567,13 +1385,93 @@ double quad_goodness(apriltag_family_t *family, image_u8_t *im, struct quad *qua
     return margin;
 }
 
-// returns the decision margin. Return < 0 if the detection should be rejected.
-float quad_decode(apriltag_family_t *family, image_u8_t *im, struct quad *quad, struct quick_decode_entry *entry, image_u8_t *im_samples)
+// Families with the same d and black_border sample the same bit
+// cells, so quads are sampled once per group of such families and the
+// code is then looked up in each of the group's decode indexes.
+struct decode_group
+{
+    const apriltag_family_t *family; // any member; gives the geometry
+    zarray_t *indexes;         // distinct apriltag_decode_index_t*
+    quad_sample_code_t sample_code;
+};
+
+static zarray_t *decode_groups_create(apriltag_detector_t *td)
+{
+    zarray_t *groups = zarray_create(sizeof(struct decode_group));
+
+    for (int famidx = 0; famidx < zarray_size(td->tag_families); famidx++) {
+        const apriltag_family_t *family;
+        zarray_get(td->tag_families, famidx, &family);
+
+        apriltag_decode_index_t *index;
+        zarray_get(td->decode_indexes, famidx, &index);
+
+        struct decode_group *group = NULL;
+        for (int i = 0; i < zarray_size(groups); i++) {
+            struct decode_group *g;
+            zarray_get_volatile(groups, i, &g);
+            if (g->family->d == family->d && g->family->black_border == family->black_border)
+                group = g;
+        }
+
+        if (group == NULL) {
+            struct decode_group g = { .family = family,
+                                      .indexes = zarray_create(sizeof(apriltag_decode_index_t*)),
+                                      .sample_code = index->sample_code };
+            zarray_add(groups, &g);
+            zarray_get_volatile(groups, zarray_size(groups) - 1, &group);
+        }
+
+        if (!zarray_contains(group->indexes, &index))
+            zarray_add(group->indexes, &index);
+    }
+
+    return groups;
+}
+
+static void decode_groups_destroy(zarray_t *groups)
+{
+    for (int i = 0; i < zarray_size(groups); i++) {
+        struct decode_group *g;
+        zarray_get_volatile(groups, i, &g);
+        zarray_destroy(g->indexes);
+    }
+    zarray_destroy(groups);
+}
+
+// Looks rcode up in the idx'th index of the group. An index built for
+// several families may return one that has since been removed from
+// the detector; that counts as no decode.
+static void decode_group_lookup(apriltag_detector_t *td, const struct decode_group *group, int idx,
+                                uint64_t rcode, struct quick_decode_entry *entry)
+{
+    apriltag_decode_index_t *index;
+    zarray_get(group->indexes, idx, &index);
+
+    quick_decode_codeword(index, rcode, entry);
+
+    if (entry->hamming < 255 && index->nfamilies > 1 && !zarray_contains(td->tag_families, &entry->family))
+        entry->hamming = 255;
+}
+
+// Reads the code of a quad, sampling the bit cells of a d x d tag
+// with the given black border width using one of the
+// HOMOGRAPHY_SAMPLE_* interpolations. Returns the decision margin, or
+// -1 if the border does not look like a tag. If min_margin > 0, also
+// returns -1 as soon as the remaining bits could no longer bring the
+// decision margin up to min_margin.
+//
+// Always inlined, so that the kernels below get the loops unrolled
+// for their constant geometry.
+QUAD_SAMPLE_INLINE float quad_sample_code_geometry(uint32_t d, uint32_t black_border,
+                                                   image_u8_t *im, const struct quad *quad, int sampling,
+                                                   float min_margin, uint64_t *prcode, image_u8_t *im_samples)
 {
     // decode the tag binary contents by sampling the pixel
     // closest to the center of each bit cell.
 
-    int64_t rcode = 0;
+    uint64_t rcode = 0;
+    *prcode = 0;
 
     // how wide do we assume the white border is?
     float white_border = 1.0;
@@ -591,17 +1489,17 @@ float quad_decode(apriltag_family_t *family, image_u8_t *im, struct quad *quad,
         1,
 
         // left black column
-        0 + family->black_border / 2.0, 0.5,
+        0 + black_border / 2.0, 0.5,
         0, 1,
         0,
 
         // right white column
-        2*family->black_border + family->d + white_border / 2.0, .5,
+        2*black_border + d + white_border / 2.0, .5,
         0, 1,
         1,
 
         // right black column
-        2*family->black_border + family->d - family->black_border / 2.0, .5,
+        2*black_border + d - black_border / 2.0, .5,
         0, 1,
         0,
 
@@ -611,17 +1509,17 @@ float quad_decode(apriltag_family_t *family, image_u8_t *im, struct quad *quad,
         1,
 
         // top black row
-        0.5, family->black_border / 2.0,
+        0.5, black_border / 2.0,
         1, 0,
         0,
 
         // bottom white row
-        0.5, 2*family->black_border + family->d + white_border / 2.0,
+        0.5, 2*black_border + d + white_border / 2.0,
         1, 0,
         1,
 
         // bottom black row
-        0.5, 2*family->black_border + family->d - family->black_border / 2.0,
+        0.5, 2*black_border + d - black_border / 2.0,
         1, 0,
         0
 
@@ -632,31 +1530,39 @@ float quad_decode(apriltag_family_t *family, image_u8_t *im, struct quad *quad,
     graymodel_init(&whitemodel);
     graymodel_init(&blackmodel);
 
+    int nsamples = 2*black_border + d;
+#ifdef _MSC_VER
+    float *values = malloc(imax(nsamples, d * d) * sizeof(float));
+#else
+    float values[imax(nsamples, d * d)];
+#endif
+
     for (int pattern_idx = 0; pattern_idx < sizeof(patterns)/(5*sizeof(float)); pattern_idx ++) {
         float *pattern = &patterns[pattern_idx * 5];
 
         int is_white = pattern[4];
 
-        for (int i = 0; i < 2*family->black_border + family->d; i++) {
-            double tagx01 = (pattern[0] + i*pattern[2]) / (2*family->black_border + family->d);
-            double tagy01 = (pattern[1] + i*pattern[3]) / (2*family->black_border + family->d);
-
-            double tagx = 2*(tagx01-0.5);
-            double tagy = 2*(tagy01-0.5);
-
-            double px, py;
-            homography_project(quad->H, tagx, tagy, &px, &py);
+        // each pattern is a line of samples in tag coordinates ([-1, 1]).
+        homography33_sample_grid(quad->H, im, sampling,
+                                 2*(pattern[0] / nsamples - 0.5), 2*(pattern[1] / nsamples - 0.5),
+                                 2*pattern[2] / nsamples, 2*pattern[3] / nsamples, 0, 0,
+                                 nsamples, 1, values);
 
-            // don't round
-            int ix = px;
-            int iy = py;
-            if (ix < 0 || iy < 0 || ix >= im->width || iy >= im->height)
+        for (int i = 0; i < nsamples; i++) {
+            float v = values[i];
+            if (v < 0)
                 continue;
 
-            int v = im->buf[iy*im->stride + ix];
+            double tagx01 = (pattern[0] + i*pattern[2]) / (2*black_border + d);
+            double tagy01 = (pattern[1] + i*pattern[3]) / (2*black_border + d);
+
+            double tagx = 2*(tagx01-0.5);
+            double tagy = 2*(tagy01-0.5);
 
             if (im_samples) {
-                im_samples->buf[iy*im_samples->stride + ix] = (1-is_white)*255;
+                double px, py;
+                homography33_project(quad->H, tagx, tagy, &px, &py);
+                im_samples->buf[(int) py*im_samples->stride + (int) px] = (1-is_white)*255;
             }
 
             if (is_white)
@@ -670,8 +1576,12 @@ float quad_decode(apriltag_family_t *family, image_u8_t *im, struct quad *quad,
     graymodel_solve(&blackmodel);
 
     // XXX Tunable
-    if (graymodel_interpolate(&whitemodel, 0, 0) - graymodel_interpolate(&blackmodel, 0, 0) < 0)
+    if (graymodel_interpolate(&whitemodel, 0, 0) - graymodel_interpolate(&blackmodel, 0, 0) < 0) {
+#ifdef _MSC_VER
+        free(values);
+#endif
         return -1;
+    }
 
     // compute the average decision margin (how far was each bit from
     // the decision boundary?
@@ -682,145 +1592,641 @@ float quad_decode(apriltag_family_t *family, image_u8_t *im, struct quad *quad,
     float black_score = 0, white_score = 0;
     float black_score_count = 1, white_score_count = 1;
 
-    for (int bitidx = 0; bitidx < family->d * family->d; bitidx++) {
-        int bitx = bitidx % family->d;
-        int bity = bitidx / family->d;
+    // the bit cell centers form a regular d x d grid.
+    double bit_size = 2.0 / (2*black_border + d);
+    homography33_sample_grid(quad->H, im, sampling,
+                             -1 + (black_border + 0.5) * bit_size,
+                             -1 + (black_border + 0.5) * bit_size,
+                             bit_size, 0, 0, bit_size,
+                             d, d, values);
+
+    // samples are in [0, 255], so a bit adds at most 255 - thresh to
+    // the white score and at most thresh to the black one. The gray
+    // models can extrapolate outside [0, 255], though, so bound these
+    // by the extremes of the (linear) threshold over the grid, which
+    // are at its corners. The bounds are padded a little to cover the
+    // rounding of the float scores.
+    float max_white_bit = 0, max_black_bit = 0;
+    if (min_margin > 0) {
+        double c = 1 - (black_border + 0.5) * bit_size;
+        for (int corner = 0; corner < 4; corner++) {
+            double x = (corner & 1) ? c : -c, y = (corner & 2) ? c : -c;
+            double thresh = (graymodel_interpolate(&blackmodel, x, y) + graymodel_interpolate(&whitemodel, x, y)) / 2.0;
+            max_white_bit = fmax(max_white_bit, 255 - thresh + 0.01);
+            max_black_bit = fmax(max_black_bit, thresh + 0.01);
+        }
+    }
 
-        double tagx01 = (family->black_border + bitx + 0.5) / (2*family->black_border + family->d);
-        double tagy01 = (family->black_border + bity + 0.5) / (2*family->black_border + family->d);
+    for (int bitidx = 0; bitidx < d * d; bitidx++) {
+        int bitx = bitidx % d;
+        int bity = bitidx / d;
+
+        double tagx01 = (black_border + bitx + 0.5) / (2*black_border + d);
+        double tagy01 = (black_border + bity + 0.5) / (2*black_border + d);
 
         // scale to [-1, 1]
         double tagx = 2*(tagx01-0.5);
         double tagy = 2*(tagy01-0.5);
 
-        double px, py;
-        homography_project(quad->H, tagx, tagy, &px, &py);
+        rcode = (rcode << 1);
+
+        float v = values[bitidx];
+        if (v < 0)
+            continue;
+
+        double thresh = (graymodel_interpolate(&blackmodel, tagx, tagy) + graymodel_interpolate(&whitemodel, tagx, tagy)) / 2.0;
+        if (v > thresh) {
+            white_score += (v - thresh);
+            white_score_count ++;
+            rcode |= 1;
+        } else {
+            black_score += (thresh - v);
+            black_score_count ++;
+        }
+
+        if (im_samples) {
+            double px, py;
+            homography33_project(quad->H, tagx, tagy, &px, &py);
+            im_samples->buf[(int) py*im_samples->stride + (int) px] = (1 - (rcode & 1)) * 255;
+        }
+
+        // no bit adds more than max_*_bit to the score of its class,
+        // so this bounds each class's final average from above.
+        if (min_margin > 0) {
+            int nleft = d * d - bitidx - 1;
+            if ((white_score + max_white_bit*nleft) / (white_score_count + nleft) < min_margin ||
+                (black_score + max_black_bit*nleft) / (black_score_count + nleft) < min_margin) {
+                black_score = -1;
+                break;
+            }
+        }
+    }
+
+#ifdef _MSC_VER
+    free(values);
+#endif
+
+    if (black_score < 0)
+        return -1;
+
+    *prcode = rcode;
+
+    return fmin(white_score / white_score_count, black_score / black_score_count);
+}
+
+// The generic kernel, for any geometry.
+float quad_sample_code(const apriltag_family_t *family, image_u8_t *im, const struct quad *quad, int sampling,
+                       float min_margin, uint64_t *prcode, image_u8_t *im_samples)
+{
+    return quad_sample_code_geometry(family->d, family->black_border, im, quad, sampling,
+                                     min_margin, prcode, im_samples);
+}
+
+// Kernels specialized for the geometries of the shipped families
+// (tag16h5, tag25h7/h9 and tag36h10/h11/artoolkit).
+#define QUAD_SAMPLE_CODE_KERNEL(D, B)                                   \
+    static float quad_sample_code_d##D##b##B(const apriltag_family_t *family, image_u8_t *im, \
+                                             const struct quad *quad, int sampling, float min_margin, \
+                                             uint64_t *prcode, image_u8_t *im_samples) \
+    {                                                                   \
+        return quad_sample_code_geometry(D, B, im, quad, sampling, min_margin, prcode, im_samples); \
+    }
+
+QUAD_SAMPLE_CODE_KERNEL(4, 1)
+QUAD_SAMPLE_CODE_KERNEL(5, 1)
+QUAD_SAMPLE_CODE_KERNEL(6, 1)
+
+quad_sample_code_t quad_sample_code_kernel(uint32_t d, uint32_t black_border)
+{
+    if (black_border == 1) {
+        switch (d) {
+            case 4: return quad_sample_code_d4b1;
+            case 5: return quad_sample_code_d5b1;
+            case 6: return quad_sample_code_d6b1;
+        }
+    }
+
+    return quad_sample_code;
+}
+
+// The first level of the early rejection cascade: compares a few
+// samples of the white border against the black border, three along
+// the middle of each side. Returns non-zero if the white samples are
+// not at least min_diff brighter on average.
+static int quad_border_rejected(const apriltag_family_t *family, image_u8_t *im, const struct quad *quad,
+                                int sampling, int min_diff)
+{
+    double bit_size = 2.0 / (2*family->black_border + family->d);
+
+    // tag coordinates of the middle of the white and black borders,
+    // as sampled by quad_sample_code().
+    double w = 1 + bit_size / 2;
+    double b = 1 - family->black_border * bit_size / 2;
+
+    double white = 0, black = 0;
+    int nwhite = 0, nblack = 0;
+
+    for (int side = 0; side < 4; side++) {
+        double sign = (side & 1) ? 1 : -1;
+        int vertical = side < 2;
+
+        for (int is_white = 0; is_white < 2; is_white++) {
+            double r = sign * (is_white ? w : b);
+            float values[3];
+
+            if (vertical)
+                homography33_sample_grid(quad->H, im, sampling, r, -.5, 0, .5, 0, 0, 3, 1, values);
+            else
+                homography33_sample_grid(quad->H, im, sampling, -.5, r, .5, 0, 0, 0, 3, 1, values);
+
+            for (int i = 0; i < 3; i++) {
+                if (values[i] < 0)
+                    continue;
+
+                if (is_white) {
+                    white += values[i];
+                    nwhite++;
+                } else {
+                    black += values[i];
+                    nblack++;
+                }
+            }
+        }
+    }
+
+    // a tag that is mostly outside the image is left to the full test.
+    if (nwhite == 0 || nblack == 0)
+        return 0;
+
+    return white / nwhite - black / nblack < min_diff;
+}
+
+double score_goodness(const apriltag_family_t *family, image_u8_t *im, const struct quad *quad, void *user)
+{
+    return quad_goodness(family, im, quad);
+}
+
+// The homography33_sample_grid() interpolation that implements
+// td->decode_sampling.
+static int decode_interpolation(const apriltag_detector_t *td)
+{
+    if (td->decode_sampling == APRILTAG_DECODE_SAMPLING_BILINEAR)
+        return HOMOGRAPHY_SAMPLE_BILINEAR;
+    return HOMOGRAPHY_SAMPLE_NEAREST;
+}
+
+struct score_decodability_ctx
+{
+    apriltag_detector_t *td;
+    const struct decode_group *group;
+};
+
+// user is a struct score_decodability_ctx; the best decode among the
+// group's indexes is scored.
+double score_decodability(const apriltag_family_t *family, image_u8_t *im, const struct quad *quad, void *user)
+{
+    struct score_decodability_ctx *ctx = user;
+
+    uint64_t rcode;
+    float decision_margin = ctx->group->sample_code(family, im, quad, decode_interpolation(ctx->td), -1, &rcode, NULL);
+
+    int hamming = 255;
+    if (decision_margin >= 0) {
+        for (int i = 0; i < zarray_size(ctx->group->indexes); i++) {
+            struct quick_decode_entry entry;
+            decode_group_lookup(ctx->td, ctx->group, i, rcode, &entry);
+            hamming = imin(hamming, entry.hamming);
+        }
+    }
+
+    // hamming trumps decision margin; maximum value for decision_margin is 255.
+    return decision_margin - hamming*1000;
+}
+
+// Hill-climbs the corners of quad0 to maximize score, and returns the
+// best score. Candidate quads are evaluated by value on the stack, so
+// that no allocation is done per candidate.
+double optimize_quad_generic(const apriltag_family_t *family, image_u8_t *im, struct quad *quad0,
+                             float *stepsizes, int nstepsizes,
+                             double (*score)(const apriltag_family_t *family, image_u8_t *im,
+                                             const struct quad *quad, void *user),
+                             void *user)
+{
+    struct quad best_quad = *quad0;
+    double best_score = score(family, im, &best_quad, user);
+
+    for (int stepsize_idx = 0; stepsize_idx < nstepsizes; stepsize_idx++)  {
+
+        int improved = 1;
+
+        // when we make progress with a particular step size, how many
+        // times will we try to perform that same step size again?
+        // (max_repeat = 0 means ("don't repeat--- just move to the
+        // next step size").
+        // XXX Tunable
+        int max_repeat = 1;
+
+        for (int repeat = 0; repeat <= max_repeat && improved; repeat++) {
+
+            improved = 0;
+
+            // wiggle point i
+            for (int i = 0; i < 4; i++) {
+
+                float stepsize = stepsizes[stepsize_idx];
+
+                // XXX Tunable (really 1 makes the best sense since)
+                int nsteps = 1;
+
+                struct quad this_best_quad;
+                double this_best_score = best_score;
+
+                for (int sx = -nsteps; sx <= nsteps; sx++) {
+                    for (int sy = -nsteps; sy <= nsteps; sy++) {
+                        if (sx==0 && sy==0)
+                            continue;
+
+                        struct quad this_quad = best_quad;
+                        this_quad.p[i][0] = best_quad.p[i][0] + sx*stepsize;
+                        this_quad.p[i][1] = best_quad.p[i][1] + sy*stepsize;
+                        if (quad_update_homographies(&this_quad))
+                            continue;
+
+                        double this_score = score(family, im, &this_quad, user);
+
+                        if (this_score > this_best_score) {
+                            this_best_quad = this_quad;
+                            this_best_score = this_score;
+                        }
+                    }
+                }
+
+                if (this_best_score > best_score) {
+                    best_quad = this_best_quad;
+                    best_score = this_best_score;
+                    improved = 1;
+                }
+            }
+        }
+    }
+
+    *quad0 = best_quad;
+    return best_score;
+}
+
+// The parameters of the border model fit by refine_quad_gauss_newton():
+// the eight corner coordinates, the black and white levels, and the
+// width of the blur across the border, in pixels.
+#define GN_NPARAMS 11
+
+// Accumulates the normal equations of the border model at params into
+// JtJ and Jtr, and returns the sum of squared residuals. Pixels are
+// the ones sampled along the edges of the initial quad p0.
+static double gn_border_normal_equations(const image_u8_t *im, const double p0[4][2], double band,
+                                         const double *params, double *JtJ, double *Jtr)
+{
+    const double inv_sqrt_2pi = 0.3989422804014327;
+
+    const double (*p)[2] = (const double (*)[2]) params;
+    double black = params[8], white = params[9], sigma = params[10];
+
+    double cx = (p[0][0] + p[1][0] + p[2][0] + p[3][0]) / 4;
+    double cy = (p[0][1] + p[1][1] + p[2][1] + p[3][1]) / 4;
+
+    if (JtJ) {
+        memset(JtJ, 0, sizeof(double)*GN_NPARAMS*GN_NPARAMS);
+        memset(Jtr, 0, sizeof(double)*GN_NPARAMS);
+    }
+
+    double err = 0;
+
+    for (int edge = 0; edge < 4; edge++) {
+        int ia = edge, ib = (edge + 1) & 3;
+        const double *a = p[ia], *b = p[ib];
+
+        double ex = b[0] - a[0], ey = b[1] - a[1];
+        double L = sqrt(ex*ex + ey*ey);
+
+        // signed distance is positive outside of the quad (on the white
+        // border).
+        double s = ((cx - a[0])*ey - (cy - a[1])*ex) > 0 ? -1 : 1;
+
+        // the pixels are fixed by the initial quad, so that the
+        // objective does not jump as the corners move. Samples near the
+        // corners are skipped: they see two edges.
+        double ex0 = p0[ib][0] - p0[ia][0], ey0 = p0[ib][1] - p0[ia][1];
+        double L0 = sqrt(ex0*ex0 + ey0*ey0);
+        double nx0 = s*ey0 / L0, ny0 = -s*ex0 / L0;
+
+        int nalong = imin(64, imax(4, 0.7*L0));
+        int nacross = 2*ceil(band) + 1;
+
+        for (int i = 0; i < nalong; i++) {
+            double t = 0.15 + 0.7 * (i + .5) / nalong;
+
+            for (int j = 0; j < nacross; j++) {
+                double u = -band + 2 * band * j / (nacross - 1);
+
+                int ix = p0[ia][0] + t*ex0 + u*nx0;
+                int iy = p0[ia][1] + t*ey0 + u*ny0;
+                if (ix < 0 || iy < 0 || ix >= im->width || iy >= im->height)
+                    continue;
+
+                double x = ix + .5, y = iy + .5;
+                double c = (x - a[0])*ey - (y - a[1])*ex;
+                double dist = s*c / L;
+
+                double z = dist / sigma;
+                double phi = 0.5 * erfc(-z * M_SQRT1_2);
+                double dphi = inv_sqrt_2pi * exp(-0.5*z*z);
+
+                double r = im->buf[iy*im->stride + ix] - (black + (white - black)*phi);
+                err += r*r;
+
+                if (!JtJ)
+                    continue;
+
+                // d(model)/d(dist), then the chain rule through dist
+                // = s*c/L to the two corners of this edge.
+                double dm = (white - black) * dphi / sigma;
+                double cL = c / (L*L*L);
+
+                double J[GN_NPARAMS] = { 0 };
+                J[2*ia + 0] = s*dm * ((y - b[1]) / L + cL*ex);
+                J[2*ia + 1] = s*dm * ((b[0] - x) / L + cL*ey);
+                J[2*ib + 0] = s*dm * ((a[1] - y) / L - cL*ex);
+                J[2*ib + 1] = s*dm * ((x - a[0]) / L - cL*ey);
+                J[8] = 1 - phi;
+                J[9] = phi;
+                J[10] = -(white - black) * dphi * z / sigma;
+
+                // J is the gradient of the model, so the residual's
+                // gradient is -J; the sign is folded into Jtr.
+                for (int m = 0; m < GN_NPARAMS; m++) {
+                    if (J[m] == 0)
+                        continue;
+                    Jtr[m] += J[m]*r;
+                    for (int n = 0; n <= m; n++)
+                        JtJ[m*GN_NPARAMS + n] += J[m]*J[n];
+                }
+            }
+        }
+    }
+
+    if (JtJ) {
+        for (int m = 0; m < GN_NPARAMS; m++)
+            for (int n = m + 1; n < GN_NPARAMS; n++)
+                JtJ[m*GN_NPARAMS + n] = JtJ[n*GN_NPARAMS + m];
+    }
+
+    return err;
+}
+
+// Refines the corners of quad by fitting a model of the tag's outer
+// border to the image: across each edge, the intensity steps from a
+// black to a white level, blurred by a Gaussian. The eight corner
+// coordinates, both levels and the blur are fit jointly by
+// Levenberg-Marquardt, which typically converges in a few iterations.
+//
+// Returns non-zero, leaving quad unchanged, if the fit fails.
+static int refine_quad_gauss_newton(const apriltag_family_t *family, image_u8_t *im, struct quad *quad)
+{
+    double p0[4][2];
+    for (int i = 0; i < 4; i++) {
+        p0[i][0] = quad->p[i][0];
+        p0[i][1] = quad->p[i][1];
+    }
+
+    // the samples may not reach past the black border into the data
+    // bits, nor past the white border.
+    double perimeter = 0;
+    for (int i = 0; i < 4; i++) {
+        int j = (i + 1) & 3;
+        perimeter += sqrt(sq(p0[j][0] - p0[i][0]) + sq(p0[j][1] - p0[i][1]));
+    }
+    double bit_px = perimeter / 4 / (family->d + 2*family->black_border);
+    double band = fmin(3, 0.75 * bit_px);
+    if (band < 1)
+        return -1;
 
-        rcode = (rcode << 1);
+    double params[GN_NPARAMS];
+    memcpy(params, p0, sizeof(p0));
+
+    // the levels are initialized from the quad's border.
+    double bit_size = 2.0 / (family->d + 2*family->black_border);
+    double black = 0, white = 0;
+    int nblack = 0, nwhite = 0;
+    for (int side = 0; side < 4; side++) {
+        for (int i = 0; i < 8; i++) {
+            double t = -.75 + 1.5 * i / 7;
+
+            for (int ring = 0; ring < 2; ring++) {
+                double o = ring ? 1 + .5*bit_size : 1 - .5*bit_size;
+                double tx = (side & 1) ? (side == 1 ? o : -o) : t;
+                double ty = (side & 1) ? t : (side == 0 ? -o : o);
+
+                double x, y;
+                homography33_project(quad->H, tx, ty, &x, &y);
+                int ix = x, iy = y;
+                if (ix < 0 || iy < 0 || ix >= im->width || iy >= im->height)
+                    continue;
 
-        // don't round.
-        int ix = px;
-        int iy = py;
+                if (ring) {
+                    white += im->buf[iy*im->stride + ix];
+                    nwhite++;
+                } else {
+                    black += im->buf[iy*im->stride + ix];
+                    nblack++;
+                }
+            }
+        }
+    }
+    if (nblack == 0 || nwhite == 0)
+        return -1;
 
-        if (ix < 0 || iy < 0 || ix >= im->width || iy >= im->height)
-            continue;
+    params[8] = black / nblack;
+    params[9] = white / nwhite;
+    params[10] = 0.7;
 
-        int v = im->buf[iy*im->stride + ix];
+    double JtJ[GN_NPARAMS*GN_NPARAMS], Jtr[GN_NPARAMS];
+    double err = gn_border_normal_equations(im, p0, band, params, JtJ, Jtr);
+    double lambda = 1e-3;
 
-        double thresh = (graymodel_interpolate(&blackmodel, tagx, tagy) + graymodel_interpolate(&whitemodel, tagx, tagy)) / 2.0;
-        if (v > thresh) {
-            white_score += (v - thresh);
-            white_score_count ++;
-            rcode |= 1;
+    // XXX Tunable
+    const int max_iters = 10;
+
+    for (int iter = 0; iter < max_iters; iter++) {
+        double A[GN_NPARAMS*GN_NPARAMS], delta[GN_NPARAMS];
+        memcpy(A, JtJ, sizeof(A));
+        memcpy(delta, Jtr, sizeof(delta));
+        for (int m = 0; m < GN_NPARAMS; m++)
+            A[m*GN_NPARAMS + m] += lambda * (JtJ[m*GN_NPARAMS + m] + 1e-9);
+
+        if (matd_sym_solve(A, delta, GN_NPARAMS))
+            return -1;
+
+        double trial[GN_NPARAMS];
+        for (int m = 0; m < GN_NPARAMS; m++)
+            trial[m] = params[m] + delta[m];
+
+        double step = 0;
+        for (int m = 0; m < 8; m++)
+            step = fmax(step, fabs(delta[m]));
+
+        double trial_err = HUGE_VAL;
+        if (trial[10] > 0.05 && trial[9] > trial[8])
+            trial_err = gn_border_normal_equations(im, p0, band, trial, NULL, NULL);
+
+        if (trial_err < err) {
+            memcpy(params, trial, sizeof(params));
+            err = gn_border_normal_equations(im, p0, band, params, JtJ, Jtr);
+            lambda = fmax(1e-7, lambda / 10);
         } else {
-            black_score += (thresh - v);
-            black_score_count ++;
+            lambda *= 10;
         }
 
-        if (im_samples)
-            im_samples->buf[iy*im_samples->stride + ix] = (1 - (rcode & 1)) * 255;
+        // XXX Tunable
+        if (step < 1e-3)
+            break;
     }
 
-    quick_decode_codeword(family, rcode, entry);
+    // the fit should not have wandered off of the sampled pixels.
+    struct quad refined = *quad;
+    for (int i = 0; i < 4; i++) {
+        if (fabs(params[2*i] - p0[i][0]) > band || fabs(params[2*i + 1] - p0[i][1]) > band)
+            return -1;
+        refined.p[i][0] = params[2*i];
+        refined.p[i][1] = params[2*i + 1];
+    }
 
-    return fmin(white_score / white_score_count, black_score / black_score_count);
-}
+    if (quad_update_homographies(&refined))
+        return -1;
 
-double score_goodness(apriltag_family_t *family, image_u8_t *im, struct quad *quad, void *user)
-{
-    return quad_goodness(family, im, quad);
+    *quad = refined;
+    return 0;
 }
 
-double score_decodability(apriltag_family_t *family, image_u8_t *im, struct quad *quad, void *user)
-{
-    struct quick_decode_entry entry;
-
-    float decision_margin = quad_decode(family, im, quad, &entry, NULL);
-
-    // hamming trumps decision margin; maximum value for decision_margin is 255.
-    return decision_margin - entry.hamming*1000;
-}
+// The offsets searched along the normal of an edge by refine_edges():
+// the offset n, and the two points (x1,y1) and (x2,y2) whose
+// difference is the gradient at n, relative to the point on the edge.
+enum { REFINE_N, REFINE_X1, REFINE_Y1, REFINE_X2, REFINE_Y2, REFINE_NFIELDS };
 
-// returns score of best quad
-double optimize_quad_generic(apriltag_family_t *family, image_u8_t *im, struct quad *quad0,
-                             float *stepsizes, int nstepsizes,
-                             double (*score)(apriltag_family_t *family, image_u8_t *im, struct quad *quad, void *user),
-                             void *user)
+// Searches along the normal of an edge through (x0,y0) for a strong
+// response, and returns the offsets averaged by the squared gradient
+// in *n0. Returns 0 if no offset had a gradient of the right sign.
+static int refine_edges_search(const image_u8_t *im, double x0, double y0,
+                               const double (*offsets)[REFINE_NFIELDS], int noffsets, double *n0)
 {
-    struct quad *best_quad = quad_copy(quad0);
-    double best_score = score(family, im, best_quad, user);
-
-    for (int stepsize_idx = 0; stepsize_idx < nstepsizes; stepsize_idx++)  {
+    double Mn = 0;
+    double Mcount = 0;
 
-        int improved = 1;
+    for (int k = 0; k < noffsets; k++) {
+        int x1 = x0 + offsets[k][REFINE_X1];
+        int y1 = y0 + offsets[k][REFINE_Y1];
+        if (x1 < 0 || x1 >= im->width || y1 < 0 || y1 >= im->height)
+            continue;
 
-        // when we make progress with a particular step size, how many
-        // times will we try to perform that same step size again?
-        // (max_repeat = 0 means ("don't repeat--- just move to the
-        // next step size").
-        // XXX Tunable
-        int max_repeat = 1;
+        int x2 = x0 + offsets[k][REFINE_X2];
+        int y2 = y0 + offsets[k][REFINE_Y2];
+        if (x2 < 0 || x2 >= im->width || y2 < 0 || y2 >= im->height)
+            continue;
 
-        for (int repeat = 0; repeat <= max_repeat && improved; repeat++) {
+        int g1 = im->buf[y1*im->stride + x1];
+        int g2 = im->buf[y2*im->stride + x2];
 
-            improved = 0;
+        if (g1 < g2) // reject points whose gradient is "backwards". They can only hurt us.
+            continue;
 
-            // wiggle point i
-            for (int i = 0; i < 4; i++) {
+        double weight = (g2 - g1)*(g2 - g1); // XXX tunable. What shape for weight=f(g2-g1)?
 
-                float stepsize = stepsizes[stepsize_idx];
+        // compute weighted average of the gradient at this point.
+        Mn += weight*offsets[k][REFINE_N];
+        Mcount += weight;
+    }
 
-                // XXX Tunable (really 1 makes the best sense since)
-                int nsteps = 1;
+    // what was the average point along the line?
+    if (Mcount == 0)
+        return 0;
 
-                struct quad *this_best_quad = NULL;
-                double this_best_score = best_score;
+    *n0 = Mn / Mcount;
+    return 1;
+}
 
-                for (int sx = -nsteps; sx <= nsteps; sx++) {
-                    for (int sy = -nsteps; sy <= nsteps; sy++) {
-                        if (sx==0 && sy==0)
-                            continue;
+#ifdef HOMOGRAPHY_HAVE_SSE2
+// refine_edges_search() for two points at once, one per lane. Returns
+// n0 in the lanes whose search succeeded, which are all ones in *valid.
+// The pixel coordinates are truncated and checked like the scalar
+// version, and the sums are accumulated in the same order, so the
+// results are identical.
+static __m128d refine_edges_search2(const image_u8_t *im, __m128d x0, __m128d y0,
+                                    const double (*offsets)[REFINE_NFIELDS], int noffsets, __m128d *valid)
+{
+    const __m128i lo = _mm_set1_epi32(-1);
+    const __m128i hi = _mm_set_epi32(im->height, im->height, im->width, im->width);
 
-                        struct quad *this_quad = quad_copy(best_quad);
-                        this_quad->p[i][0] = best_quad->p[i][0] + sx*stepsize;
-                        this_quad->p[i][1] = best_quad->p[i][1] + sy*stepsize;
-                        if (quad_update_homographies(this_quad))
-                            continue;
+    __m128d Mn = _mm_setzero_pd(), Mcount = _mm_setzero_pd();
 
-                        double this_score = score(family, im, this_quad, user);
+    for (int k = 0; k < noffsets; k++) {
+        const double *o = offsets[k];
 
-                        if (this_score > this_best_score) {
-                            quad_destroy(this_best_quad);
+        // [x1 x1 y1 y1] and [x2 x2 y2 y2] for lanes [a b a b]
+        __m128i p1 = _mm_unpacklo_epi64(_mm_cvttpd_epi32(_mm_add_pd(x0, _mm_set1_pd(o[REFINE_X1]))),
+                                        _mm_cvttpd_epi32(_mm_add_pd(y0, _mm_set1_pd(o[REFINE_Y1]))));
+        __m128i p2 = _mm_unpacklo_epi64(_mm_cvttpd_epi32(_mm_add_pd(x0, _mm_set1_pd(o[REFINE_X2]))),
+                                        _mm_cvttpd_epi32(_mm_add_pd(y0, _mm_set1_pd(o[REFINE_Y2]))));
 
-                            this_best_quad = this_quad;
-                            this_best_score = this_score;
-                        } else {
-                            quad_destroy(this_quad);
-                        }
-                    }
-                }
+        __m128i inside = _mm_and_si128(_mm_and_si128(_mm_cmpgt_epi32(p1, lo), _mm_cmplt_epi32(p1, hi)),
+                                       _mm_and_si128(_mm_cmpgt_epi32(p2, lo), _mm_cmplt_epi32(p2, hi)));
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(inside));
+        if ((mask & 5) != 5 && (mask & 10) != 10)
+            continue;
 
-                if (this_best_score > best_score) {
-                    quad_destroy(best_quad);
-                    best_quad = this_best_quad;
-                    best_score = this_best_score;
-                    improved = 1;
-                }
-            }
+        int c1[4], c2[4];
+        _mm_storeu_si128((__m128i*) c1, p1);
+        _mm_storeu_si128((__m128i*) c2, p2);
+
+        // the gradient of a lane outside the image is zero, which adds
+        // nothing.
+        int d[2] = { 0, 0 };
+        for (int lane = 0; lane < 2; lane++) {
+            int bits = 5 << lane;
+            if ((mask & bits) == bits)
+                d[lane] = im->buf[c2[2+lane]*im->stride + c2[lane]] - im->buf[c1[2+lane]*im->stride + c1[lane]];
         }
+
+        // reject points whose gradient is "backwards".
+        __m128d weight = _mm_set_pd(d[1] <= 0 ? d[1]*d[1] : 0, d[0] <= 0 ? d[0]*d[0] : 0);
+
+        Mn = _mm_add_pd(Mn, _mm_mul_pd(weight, _mm_set1_pd(o[REFINE_N])));
+        Mcount = _mm_add_pd(Mcount, weight);
     }
 
-    matd_destroy(quad0->H);
-    matd_destroy(quad0->Hinv);
-    memcpy(quad0, best_quad, sizeof(struct quad)); // copy pointers
-    free(best_quad);
-    return best_score;
+    *valid = _mm_cmpneq_pd(Mcount, _mm_setzero_pd());
+    return _mm_div_pd(Mn, _mm_or_pd(Mcount, _mm_andnot_pd(*valid, _mm_set1_pd(1))));
 }
+#endif
 
 static void refine_edges(apriltag_detector_t *td, image_u8_t *im_orig, struct quad *quad)
 {
     double lines[4][4]; // for each line, [Ex Ey nx ny]
 
+    // XXX tunable: how far to search?  We want to search far
+    // enough that we find the best edge, but not so far that
+    // we hit other edges that aren't part of the tag. We
+    // shouldn't ever have to search more than quad_decimate,
+    // since otherwise we would (ideally) have started our
+    // search on another pixel in the first place. Likewise,
+    // for very small tags, we don't want the range to be too
+    // big.
+    double range = td->quad_decimate + 1;
+
+    int maxoffsets = 8*range + 2;
+#ifdef _MSC_VER
+    double (*offsets)[REFINE_NFIELDS] = malloc(maxoffsets * sizeof *offsets);
+#else
+    double offsets[maxoffsets][REFINE_NFIELDS];
+#endif
+
     for (int edge = 0; edge < 4; edge++) {
         int a = edge, b = (edge + 1) & 3; // indices of the end points.
 
@@ -831,6 +2237,26 @@ static void refine_edges(apriltag_detector_t *td, image_u8_t *im_orig, struct qu
         nx /= mag;
         ny /= mag;
 
+        // XXX tunable step size.
+        int noffsets = 0;
+        for (double n = -range; n <= range && noffsets < maxoffsets; n +=  0.25) {
+            // Because of the guaranteed winding order of the
+            // points in the quad, we will start inside the white
+            // portion of the quad and work our way outward.
+            //
+            // sample to points (x1,y1) and (x2,y2) XXX tunable:
+            // how far +/- to look? Small values compute the
+            // gradient more precisely, but are more sensitive to
+            // noise.
+            double grange = 1;
+            offsets[noffsets][REFINE_N] = n;
+            offsets[noffsets][REFINE_X1] = (n + grange)*nx;
+            offsets[noffsets][REFINE_Y1] = (n + grange)*ny;
+            offsets[noffsets][REFINE_X2] = (n - grange)*nx;
+            offsets[noffsets][REFINE_Y2] = (n - grange)*ny;
+            noffsets++;
+        }
+
         // we will now fit a NEW line by sampling points near
         // our original line that have large gradients. On really big tags,
         // we're willing to sample more to get an even better estimate.
@@ -839,7 +2265,52 @@ static void refine_edges(apriltag_detector_t *td, image_u8_t *im_orig, struct qu
         // stats for fitting a line...
         double Mx = 0, My = 0, Mxx = 0, Mxy = 0, Myy = 0, N = 0;
 
-        for (int s = 0; s < nsamples; s++) {
+        int s = 0;
+
+#ifdef HOMOGRAPHY_HAVE_SSE2
+        {
+            __m128d vMx = _mm_setzero_pd(), vMy = _mm_setzero_pd(), vMxx = _mm_setzero_pd();
+            __m128d vMxy = _mm_setzero_pd(), vMyy = _mm_setzero_pd(), vN = _mm_setzero_pd();
+            const __m128d one = _mm_set1_pd(1);
+
+            for (; s + 1 < nsamples; s += 2) {
+                __m128d alpha = _mm_div_pd(_mm_set_pd(2.0 + s, 1.0 + s), _mm_set1_pd(nsamples + 1));
+                __m128d x0 = _mm_add_pd(_mm_mul_pd(alpha, _mm_set1_pd(quad->p[a][0])),
+                                        _mm_mul_pd(_mm_sub_pd(one, alpha), _mm_set1_pd(quad->p[b][0])));
+                __m128d y0 = _mm_add_pd(_mm_mul_pd(alpha, _mm_set1_pd(quad->p[a][1])),
+                                        _mm_mul_pd(_mm_sub_pd(one, alpha), _mm_set1_pd(quad->p[b][1])));
+
+                __m128d valid;
+                __m128d n0 = refine_edges_search2(im_orig, x0, y0, offsets, noffsets, &valid);
+
+                __m128d bestx = _mm_and_pd(valid, _mm_add_pd(x0, _mm_mul_pd(n0, _mm_set1_pd(nx))));
+                __m128d besty = _mm_and_pd(valid, _mm_add_pd(y0, _mm_mul_pd(n0, _mm_set1_pd(ny))));
+
+                vMx = _mm_add_pd(vMx, bestx);
+                vMy = _mm_add_pd(vMy, besty);
+                vMxx = _mm_add_pd(vMxx, _mm_mul_pd(bestx, bestx));
+                vMxy = _mm_add_pd(vMxy, _mm_mul_pd(bestx, besty));
+                vMyy = _mm_add_pd(vMyy, _mm_mul_pd(besty, besty));
+                vN = _mm_add_pd(vN, _mm_and_pd(valid, one));
+            }
+
+            double sums[6][2];
+            _mm_storeu_pd(sums[0], vMx);
+            _mm_storeu_pd(sums[1], vMy);
+            _mm_storeu_pd(sums[2], vMxx);
+            _mm_storeu_pd(sums[3], vMxy);
+            _mm_storeu_pd(sums[4], vMyy);
+            _mm_storeu_pd(sums[5], vN);
+            Mx = sums[0][0] + sums[0][1];
+            My = sums[1][0] + sums[1][1];
+            Mxx = sums[2][0] + sums[2][1];
+            Mxy = sums[3][0] + sums[3][1];
+            Myy = sums[4][0] + sums[4][1];
+            N = sums[5][0] + sums[5][1];
+        }
+#endif
+
+        for (; s < nsamples; s++) {
             // compute a point along the line... Note, we're avoiding
             // sampling *right* at the corners, since those points are
             // the least reliable.
@@ -848,61 +2319,11 @@ static void refine_edges(apriltag_detector_t *td, image_u8_t *im_orig, struct qu
             double y0 = alpha*quad->p[a][1] + (1-alpha)*quad->p[b][1];
 
             // search along the normal to this line, looking at the
-            // gradients along the way. We're looking for a strong
-            // response.
-            double Mn = 0;
-            double Mcount = 0;
-
-            // XXX tunable: how far to search?  We want to search far
-            // enough that we find the best edge, but not so far that
-            // we hit other edges that aren't part of the tag. We
-            // shouldn't ever have to search more than quad_decimate,
-            // since otherwise we would (ideally) have started our
-            // search on another pixel in the first place. Likewise,
-            // for very small tags, we don't want the range to be too
-            // big.
-            double range = td->quad_decimate + 1;
-
-            // XXX tunable step size.
-            for (double n = -range; n <= range; n +=  0.25) {
-                // Because of the guaranteed winding order of the
-                // points in the quad, we will start inside the white
-                // portion of the quad and work our way outward.
-                //
-                // sample to points (x1,y1) and (x2,y2) XXX tunable:
-                // how far +/- to look? Small values compute the
-                // gradient more precisely, but are more sensitive to
-                // noise.
-                double grange = 1;
-                int x1 = x0 + (n + grange)*nx;
-                int y1 = y0 + (n + grange)*ny;
-                if (x1 < 0 || x1 >= im_orig->width || y1 < 0 || y1 >= im_orig->height)
-                    continue;
-
-                int x2 = x0 + (n - grange)*nx;
-                int y2 = y0 + (n - grange)*ny;
-                if (x2 < 0 || x2 >= im_orig->width || y2 < 0 || y2 >= im_orig->height)
-                    continue;
-
-                int g1 = im_orig->buf[y1*im_orig->stride + x1];
-                int g2 = im_orig->buf[y2*im_orig->stride + x2];
-
-                if (g1 < g2) // reject points whose gradient is "backwards". They can only hurt us.
-                    continue;
-
-                double weight = (g2 - g1)*(g2 - g1); // XXX tunable. What shape for weight=f(g2-g1)?
-
-                // compute weighted average of the gradient at this point.
-                Mn += weight*n;
-                Mcount += weight;
-            }
-
-            // what was the average point along the line?
-            if (Mcount == 0)
+            // gradients along the way.
+            double n0;
+            if (!refine_edges_search(im_orig, x0, y0, offsets, noffsets, &n0))
                 continue;
 
-            double n0 = Mn / Mcount;
-
             // where is the point along the line?
             double bestx = x0 + n0*nx;
             double besty = y0 + n0*ny;
@@ -931,6 +2352,10 @@ static void refine_edges(apriltag_detector_t *td, image_u8_t *im_orig, struct qu
         lines[edge][3] = ny;
     }
 
+#ifdef _MSC_VER
+    free(offsets);
+#endif
+
     // now refit the corners of the quad
     for (int i = 0; i < 4; i++) {
 
@@ -959,11 +2384,100 @@ static void refine_edges(apriltag_detector_t *td, image_u8_t *im_orig, struct qu
     }
 }
 
+// Improves the quad corner positions by maximizing the contrast
+// around the border, and returns the goodness of the result.
+static double quad_refine_pose(apriltag_detector_t *td, const apriltag_family_t *family,
+                               image_u8_t *im, struct quad *quad)
+{
+    if (td->refine_pose_mode == APRILTAG_REFINE_POSE_GAUSS_NEWTON) {
+        // on failure, the quad is left as it was.
+        refine_quad_gauss_newton(family, im, quad);
+        return quad_goodness(family, im, quad);
+    }
+
+    // NB: We potentially step an integer
+    // number of times in each direction. To make each
+    // sample as useful as possible, the step sizes should
+    // not be integer multiples of each other. (I.e.,
+    // probably don't use 1, 0.5, 0.25, etc.)
+
+    // XXX Tunable
+    float stepsizes[] = { 1, .4, .16, .064 };
+    int nstepsizes = sizeof(stepsizes)/sizeof(float);
+
+    return optimize_quad_generic(family, im, quad, stepsizes, nstepsizes, score_goodness, NULL);
+}
+
+// Moves the quad corners to where the code decodes best.
+static void quad_refine_decode(apriltag_detector_t *td, const struct decode_group *group,
+                               image_u8_t *im, struct quad *quad)
+{
+    // this optimizes decodability, but we don't report
+    // that value to the user.  (so discard return value.)
+    // XXX Tunable
+    float stepsizes[] = { .4 };
+    int nstepsizes = sizeof(stepsizes)/sizeof(float);
+
+    struct score_decodability_ctx ctx = { .td = td, .group = group };
+    optimize_quad_generic(group->family, im, quad, stepsizes, nstepsizes, score_decodability, &ctx);
+}
+
+enum decode_probe
+{
+    DECODE_PROBE_DECODED,
+    DECODE_PROBE_NEAR_MISS,
+    DECODE_PROBE_MISS,
+};
+
+// Classifies a code read from an unrefined quad for td->decode_first.
+static enum decode_probe decode_group_probe(apriltag_detector_t *td, const struct decode_group *group,
+                                            float decision_margin, uint64_t rcode)
+{
+    // XXX Tunable
+    const int near_miss_hamming = 2;
+    const float near_miss_margin = 0.5; // of min_decision_margin
+
+    if (decision_margin < 0)
+        return DECODE_PROBE_MISS;
+
+    int decoded = 0;
+    for (int i = 0; i < zarray_size(group->indexes) && !decoded; i++) {
+        struct quick_decode_entry entry;
+        decode_group_lookup(td, group, i, rcode, &entry);
+        decoded = entry.hamming < 255;
+    }
+
+    if (decoded) {
+        if (decision_margin >= td->min_decision_margin)
+            return DECODE_PROBE_DECODED;
+        if (decision_margin >= near_miss_margin * td->min_decision_margin)
+            return DECODE_PROBE_NEAR_MISS;
+        return DECODE_PROBE_MISS;
+    }
+
+    // only refine_decode cares about near misses.
+    if (!td->refine_decode)
+        return DECODE_PROBE_MISS;
+
+    // for a multi-family index, this may count the codes of families
+    // that are not being detected; that only costs a refinement.
+    for (int i = 0; i < zarray_size(group->indexes); i++) {
+        apriltag_decode_index_t *index;
+        zarray_get(group->indexes, i, &index);
+
+        if (quick_decode_nearest_hamming(index, rcode) <= index->maxhamming + near_miss_hamming)
+            return DECODE_PROBE_NEAR_MISS;
+    }
+
+    return DECODE_PROBE_MISS;
+}
+
 static void quad_decode_task(void *_u)
 {
     struct quad_decode_task *task = (struct quad_decode_task*) _u;
     apriltag_detector_t *td = task->td;
     image_u8_t *im = task->im;
+    int interpolation = decode_interpolation(td);
 
     for (int quadidx = task->i0; quadidx < task->i1; quadidx++) {
         struct quad *quad_original;
@@ -977,97 +2491,136 @@ static void quad_decode_task(void *_u)
         }
 
         // make sure the homographies are computed...
-        if (quad_update_homographies(quad_original))
+        if (quad_update_homographies(quad_original)) {
+            task->nhomography_failed++;
             continue;
+        }
 
-        for (int famidx = 0; famidx < zarray_size(td->tag_families); famidx++) {
-            apriltag_family_t *family;
-            zarray_get(td->tag_families, famidx, &family);
+        for (int groupidx = 0; groupidx < zarray_size(task->groups); groupidx++) {
+            struct decode_group *group;
+            zarray_get_volatile(task->groups, groupidx, &group);
+            const apriltag_family_t *family = group->family;
 
             double goodness = 0;
 
             // since the geometry of tag families can vary, start any
             // optimization process over with the original quad.
-            struct quad *quad = quad_copy(quad_original);
-
-            // improve the quad corner positions by minimizing the
-            // variance within each intra-bit area.
-            if (td->refine_pose) {
-                // NB: We potentially step an integer
-                // number of times in each direction. To make each
-                // sample as useful as possible, the step sizes should
-                // not be integer multiples of each other. (I.e.,
-                // probably don't use 1, 0.5, 0.25, etc.)
-
-                // XXX Tunable
-                float stepsizes[] = { 1, .4, .16, .064 };
-                int nstepsizes = sizeof(stepsizes)/sizeof(float);
-
-                goodness = optimize_quad_generic(family, im, quad, stepsizes, nstepsizes, score_goodness, NULL);
+            struct quad quad_family = *quad_original;
+            struct quad *quad = &quad_family;
+
+            if (td->decode_early_reject &&
+                quad_border_rejected(family, im, quad, interpolation, td->qtp.min_white_black_diff)) {
+                task->nborder_rejected++;
+                continue;
             }
 
-            if (td->refine_decode) {
-                // this optimizes decodability, but we don't report
-                // that value to the user.  (so discard return value.)
-                // XXX Tunable
-                float stepsizes[] = { .4 };
-                int nstepsizes = sizeof(stepsizes)/sizeof(float);
+            uint64_t rcode;
+            float decision_margin = 0;
+            int sampled = 0; // are rcode and decision_margin those of quad?
 
-                optimize_quad_generic(family, im, quad, stepsizes, nstepsizes, score_decodability, NULL);
-            }
+            if (td->decode_first && (td->refine_pose || td->refine_decode)) {
+                // margins below min_decision_margin may be near misses.
+                decision_margin = group->sample_code(family, im, quad, interpolation,
+                                                     (td->decode_early_reject && !td->refine_decode) ?
+                                                     td->min_decision_margin : -1,
+                                                     &rcode, task->im_samples);
+                sampled = 1;
 
-            struct quick_decode_entry entry;
+                enum decode_probe probe = decode_group_probe(td, group, decision_margin, rcode);
 
-            float decision_margin = quad_decode(family, im, quad, &entry, task->im_samples);
+                if (probe == DECODE_PROBE_NEAR_MISS && td->refine_decode) {
+                    quad_refine_decode(td, group, im, quad);
+                    task->nrefine_decode++;
 
-            if (entry.hamming < 255 && decision_margin >= 0) {
-                apriltag_detection_t *det = calloc(1, sizeof(apriltag_detection_t));
+                    decision_margin = group->sample_code(family, im, quad, interpolation, -1,
+                                                         &rcode, task->im_samples);
+                    probe = decode_group_probe(td, group, decision_margin, rcode);
+                }
+
+                if (probe == DECODE_PROBE_DECODED && td->refine_pose) {
+                    goodness = quad_refine_pose(td, family, im, quad);
+                    task->nrefine_pose++;
+                    sampled = 0;
+                }
+            } else {
+                // improve the quad corner positions by minimizing the
+                // variance within each intra-bit area.
+                if (td->refine_pose) {
+                    goodness = quad_refine_pose(td, family, im, quad);
+                    task->nrefine_pose++;
+                }
 
-                det->family = family;
-                det->id = entry.id;
-                det->hamming = entry.hamming;
-                det->goodness = goodness;
-                det->decision_margin = decision_margin;
+                if (td->refine_decode) {
+                    quad_refine_decode(td, group, im, quad);
+                    task->nrefine_decode++;
+                }
+            }
 
-                double theta = -entry.rotation * M_PI / 2.0;
-                double c = cos(theta), s = sin(theta);
+            if (!sampled)
+                decision_margin = group->sample_code(family, im, quad, interpolation,
+                                                     td->decode_early_reject ? td->min_decision_margin : -1,
+                                                     &rcode, task->im_samples);
 
-                // Fix the rotation of our homography to properly orient the tag
-                matd_t *R = matd_create(3,3);
-                MATD_EL(R, 0, 0) = c;
-                MATD_EL(R, 0, 1) = -s;
-                MATD_EL(R, 1, 0) = s;
-                MATD_EL(R, 1, 1) = c;
-                MATD_EL(R, 2, 2) = 1;
+            if (decision_margin < 0 || decision_margin < td->min_decision_margin) {
+                task->nmargin_rejected++;
+                continue;
+            }
 
-                det->H = matd_op("M*M", quad->H, R);
+            for (int indexidx = 0; indexidx < zarray_size(group->indexes); indexidx++) {
+                struct quick_decode_entry entry;
+                entry.hamming = 255;
+
+                decode_group_lookup(td, group, indexidx, rcode, &entry);
+
+                if (entry.hamming < 255) {
+                    apriltag_detection_t detection;
+                    memset(&detection, 0, sizeof(detection));
+                    apriltag_detection_t *det = &detection;
+
+                    det->family = entry.family;
+                    det->id = entry.id;
+                    det->hamming = entry.hamming;
+                    det->goodness = goodness;
+                    det->decision_margin = decision_margin;
+
+                    double theta = -entry.rotation * M_PI / 2.0;
+                    double c = cos(theta), s = sin(theta);
+
+                    // Fix the rotation of our homography to properly
+                    // orient the tag: H = quad->H * R, where
+                    //
+                    //     [ c -s  0 ]
+                    // R = [ s  c  0 ]
+                    //     [ 0  0  1 ]
+                    for (int i = 0; i < 3; i++) {
+                        det->H[3*i + 0] = quad->H[3*i + 0]*c + quad->H[3*i + 1]*s;
+                        det->H[3*i + 1] = -quad->H[3*i + 0]*s + quad->H[3*i + 1]*c;
+                        det->H[3*i + 2] = quad->H[3*i + 2];
+                    }
 
-                matd_destroy(R);
+                    homography33_project(det->H, 0, 0, &det->c[0], &det->c[1]);
 
-                homography_project(det->H, 0, 0, &det->c[0], &det->c[1]);
+                    // [-1, -1], [1, -1], [1, 1], [-1, 1], Desired points
+                    // [-1, 1], [1, 1], [1, -1], [-1, -1], FLIP Y
+                    // adjust the points in det->p so that they correspond to
+                    // counter-clockwise around the quad, starting at -1,-1.
+                    for (int i = 0; i < 4; i++) {
+                        int tcx = (i == 1 || i == 2) ? 1 : -1;
+                        int tcy = (i < 2) ? 1 : -1;
 
-                // [-1, -1], [1, -1], [1, 1], [-1, 1], Desired points
-                // [-1, 1], [1, 1], [1, -1], [-1, -1], FLIP Y
-                // adjust the points in det->p so that they correspond to
-                // counter-clockwise around the quad, starting at -1,-1.
-                for (int i = 0; i < 4; i++) {
-                    int tcx = (i == 1 || i == 2) ? 1 : -1;
-                    int tcy = (i < 2) ? 1 : -1;
+                        double p[2];
 
-                    double p[2];
+                        homography33_project(det->H, tcx, tcy, &p[0], &p[1]);
 
-                    homography_project(det->H, tcx, tcy, &p[0], &p[1]);
+                        det->p[i][0] = p[0];
+                        det->p[i][1] = p[1];
+                    }
 
-                    det->p[i][0] = p[0];
-                    det->p[i][1] = p[1];
+                    zarray_add(task->detections, det);
+                } else {
+                    task->ndecode_failed++;
                 }
-
-                pthread_mutex_lock(&td->mutex);
-                zarray_add(task->detections, &det);
-                pthread_mutex_unlock(&td->mutex);
             }
-
-            quad_destroy(quad);
         }
     }
 }
@@ -1077,10 +2630,57 @@ void apriltag_detection_destroy(apriltag_detection_t *det)
     if (det == NULL)
         return;
 
-    matd_destroy(det->H);
     free(det);
 }
 
+matd_t *apriltag_detection_get_H(const apriltag_detection_t *det)
+{
+    return homography33_to_matd(det->H);
+}
+
+// A detection being reconciled, with its bounding box.
+struct reconcile_entry
+{
+    apriltag_detection_t *det; // in the detections array, at idx
+    int idx;
+    double min[2], max[2];
+};
+
+// sorts by (family, id), then in detection order.
+static int reconcile_entry_compare(const void *_a, const void *_b)
+{
+    const struct reconcile_entry *a = _a, *b = _b;
+
+    if (a->det->family != b->det->family)
+        return (uintptr_t) a->det->family < (uintptr_t) b->det->family ? -1 : 1;
+    if (a->det->id != b->det->id)
+        return a->det->id < b->det->id ? -1 : 1;
+    return a->idx - b->idx;
+}
+
+// Do the quads of two detections overlap? Convex quads, the usual
+// case, are tested for a separating axis without allocating; others
+// fall back to g2d_polygon_overlaps_polygon().
+static int reconcile_entries_overlap(const struct reconcile_entry *e0, const struct reconcile_entry *e1)
+{
+    if (e0->max[0] < e1->min[0] || e1->max[0] < e0->min[0] ||
+        e0->max[1] < e1->min[1] || e1->max[1] < e0->min[1])
+        return 0;
+
+    const double (*p0)[2] = e0->det->p, (*p1)[2] = e1->det->p;
+
+    if (g2d_convex_is_convex(p0, 4) && g2d_convex_is_convex(p1, 4))
+        return g2d_convex_overlaps_convex(p0, 4, p1, 4);
+
+    zarray_t *poly0 = g2d_polygon_create_data((double (*)[2]) p0, 4);
+    zarray_t *poly1 = g2d_polygon_create_data((double (*)[2]) p1, 4);
+    int overlaps = g2d_polygon_overlaps_polygon(poly0, poly1);
+    zarray_destroy(poly0);
+    zarray_destroy(poly1);
+
+    return overlaps;
+}
+
 int prefer_smaller(int pref, double q0, double q1)
 {
     if (pref)     // already prefer something? exit.
@@ -1095,12 +2695,118 @@ int prefer_smaller(int pref, double q0, double q1)
     return 0;
 }
 
-zarray_t *apriltag_detector_detect(apriltag_detector_t *td, image_u8_t *im_orig)
+// Discards all but the preferred one of each set of overlapping
+// detections of the same tag.
+//
+// Only detections of the same tag can be duplicates, so the
+// detections are sorted into buckets by (family, id), and each
+// bucket is reconciled on its own, in detection order. The result
+// is the same as comparing every pair in detection order.
+static void reconcile_detections(apriltag_detector_t *td, zarray_t *detections)
+{
+    if (zarray_size(detections) < 2)
+        return;
+
+    if (td->reconcile_entries == NULL)
+        td->reconcile_entries = zarray_create(sizeof(struct reconcile_entry));
+
+    int ndetections = zarray_size(detections);
+    zarray_clear(td->reconcile_entries);
+
+    for (int i = 0; i < ndetections; i++) {
+        struct reconcile_entry entry;
+        zarray_get_volatile(detections, i, &entry.det);
+        entry.idx = i;
+
+        const apriltag_detection_t *det = entry.det;
+        for (int k = 0; k < 2; k++) {
+            entry.min[k] = fmin(fmin(det->p[0][k], det->p[1][k]), fmin(det->p[2][k], det->p[3][k]));
+            entry.max[k] = fmax(fmax(det->p[0][k], det->p[1][k]), fmax(det->p[2][k], det->p[3][k]));
+        }
+
+        zarray_add(td->reconcile_entries, &entry);
+    }
+
+    zarray_sort(td->reconcile_entries, reconcile_entry_compare);
+
+    struct reconcile_entry *entries;
+    zarray_get_volatile(td->reconcile_entries, 0, &entries);
+
+    for (int b0 = 0, b1; b0 < ndetections; b0 = b1) {
+        for (b1 = b0 + 1; b1 < ndetections; b1++) {
+            if (entries[b1].det->family != entries[b0].det->family || entries[b1].det->id != entries[b0].det->id)
+                break;
+        }
+
+        // a discarded detection's family is set to NULL.
+        for (int i0 = b0; i0 < b1; i0++) {
+            apriltag_detection_t *det0 = entries[i0].det;
+            if (det0->family == NULL)
+                continue;
+
+            for (int i1 = i0 + 1; i1 < b1; i1++) {
+                apriltag_detection_t *det1 = entries[i1].det;
+                if (det1->family == NULL || !reconcile_entries_overlap(&entries[i0], &entries[i1]))
+                    continue;
+
+                // the tags overlap. Delete one, keep the other.
+
+                int pref = 0; // 0 means undecided which one we'll keep.
+                pref = prefer_smaller(pref, det0->hamming, det1->hamming);     // want small hamming
+                pref = prefer_smaller(pref, -det0->decision_margin, -det1->decision_margin);      // want bigger margins
+                pref = prefer_smaller(pref, -det0->goodness, -det1->goodness); // want bigger goodness
+
+                // if we STILL don't prefer one detection over the other, then pick
+                // any deterministic criterion.
+                for (int i = 0; i < 4; i++) {
+                    pref = prefer_smaller(pref, det0->p[i][0], det1->p[i][0]);
+                    pref = prefer_smaller(pref, det0->p[i][1], det1->p[i][1]);
+                }
+
+                if (pref == 0) {
+                    // at this point, we should only be undecided if the tag detections
+                    // are *exactly* the same. How would that happen?
+                    printf("uh oh, no preference for overlappingdetection\n");
+                }
+
+                td->stats.nduplicates++;
+
+                if (pref < 0) {
+                    // keep det0, discard det1
+                    det1->family = NULL;
+                } else {
+                    // keep det1, discard det0, and go on to the
+                    // next detection.
+                    det0->family = NULL;
+                    break;
+                }
+            }
+        }
+    }
+
+    // compact the survivors in one pass, keeping their order.
+    int nkept = 0;
+    for (int i = 0; i < ndetections; i++) {
+        apriltag_detection_t *det;
+        zarray_get_volatile(detections, i, &det);
+        if (det->family == NULL)
+            continue;
+
+        if (nkept != i)
+            zarray_set(detections, nkept, det, NULL);
+        nkept++;
+    }
+    zarray_truncate(detections, nkept);
+}
+
+void apriltag_detector_detect_into(apriltag_detector_t *td, image_u8_t *im_orig, zarray_t *detections)
 {
+    assert(detections->el_sz == sizeof(apriltag_detection_t));
+    zarray_clear(detections);
+
     if (zarray_size(td->tag_families) == 0) {
-        zarray_t *s = zarray_create(sizeof(apriltag_detection_t*));
         printf("apriltag.c: No tag families enabled.");
-        return s;
+        return;
     }
 
     if (td->wp == NULL || td->nthreads != workerpool_get_nthreads(td->wp)) {
@@ -1111,6 +2817,8 @@ zarray_t *apriltag_detector_detect(apriltag_detector_t *td, image_u8_t *im_orig)
     timeprofile_clear(td->tp);
     timeprofile_stamp(td->tp, "init");
 
+    memset(&td->stats, 0, sizeof(struct apriltag_quad_stats));
+
     ///////////////////////////////////////////////////////////
     // Step 1. Detect quads according to requested image decimation
     // and blurring parameters.
@@ -1191,7 +2899,6 @@ zarray_t *apriltag_detector_detect(apriltag_detector_t *td, image_u8_t *im_orig)
     if (quad_im != im_orig)
         image_u8_destroy(quad_im);
 
-    zarray_t *detections = zarray_create(sizeof(apriltag_detection_t*));
 
     td->nquads = zarray_size(quads);
 
@@ -1225,6 +2932,7 @@ zarray_t *apriltag_detector_detect(apriltag_detector_t *td, image_u8_t *im_orig)
     // Step 2. Decode tags from each quad.
     if (1) {
         image_u8_t *im_samples = td->debug ? image_u8_copy(im_orig) : NULL;
+        zarray_t *groups = decode_groups_create(td);
 
         int chunksize = 1 + zarray_size(quads) / (APRILTAG_TASKS_PER_THREAD_TARGET * td->nthreads);
 
@@ -1236,12 +2944,27 @@ zarray_t *apriltag_detector_detect(apriltag_detector_t *td, image_u8_t *im_orig)
 
         int ntasks = 0;
         for (int i = 0; i < zarray_size(quads); i+= chunksize) {
+            // each task's detections go to an array kept by the
+            // detector, so that they are not reallocated every frame.
+            if (ntasks == zarray_size(td->task_detections)) {
+                zarray_t *task_detections = zarray_create(sizeof(apriltag_detection_t));
+                zarray_add(td->task_detections, &task_detections);
+            }
+
             tasks[ntasks].i0 = i;
             tasks[ntasks].i1 = imin(zarray_size(quads), i + chunksize);
             tasks[ntasks].quads = quads;
             tasks[ntasks].td = td;
             tasks[ntasks].im = im_orig;
-            tasks[ntasks].detections = detections;
+            tasks[ntasks].groups = groups;
+            zarray_get(td->task_detections, ntasks, &tasks[ntasks].detections);
+            zarray_clear(tasks[ntasks].detections);
+            tasks[ntasks].nhomography_failed = 0;
+            tasks[ntasks].nborder_rejected = 0;
+            tasks[ntasks].nmargin_rejected = 0;
+            tasks[ntasks].ndecode_failed = 0;
+            tasks[ntasks].nrefine_pose = 0;
+            tasks[ntasks].nrefine_decode = 0;
 
             tasks[ntasks].im_samples = im_samples;
 
@@ -1251,10 +2974,26 @@ zarray_t *apriltag_detector_detect(apriltag_detector_t *td, image_u8_t *im_orig)
 
         workerpool_run(td->wp);
 
+        // concatenating in task order (rather than adding under a
+        // lock as each detection is made) keeps the output order
+        // independent of thread scheduling.
+        for (int i = 0; i < ntasks; i++) {
+            zarray_add_all(detections, tasks[i].detections);
+
+            td->stats.nhomography_failed += tasks[i].nhomography_failed;
+            td->stats.nborder_rejected += tasks[i].nborder_rejected;
+            td->stats.nmargin_rejected += tasks[i].nmargin_rejected;
+            td->stats.ndecode_failed += tasks[i].ndecode_failed;
+            td->stats.nrefine_pose += tasks[i].nrefine_pose;
+            td->stats.nrefine_decode += tasks[i].nrefine_decode;
+        }
+
 #ifdef _MSC_VER
         free(tasks);
 #endif
 
+        decode_groups_destroy(groups);
+
         if (im_samples != NULL) {
             image_u8_write_pnm(im_samples, "debug_samples.pnm");
             image_u8_destroy(im_samples);
@@ -1291,74 +3030,7 @@ zarray_t *apriltag_detector_detect(apriltag_detector_t *td, image_u8_t *im_orig)
     ////////////////////////////////////////////////////////////////
     // Step 3. Reconcile detections--- don't report the same tag more
     // than once. (Allow non-overlapping duplicate detections.)
-    if (1) {
-        zarray_t *poly0 = g2d_polygon_create_zeros(4);
-        zarray_t *poly1 = g2d_polygon_create_zeros(4);
-
-        for (int i0 = 0; i0 < zarray_size(detections); i0++) {
-
-            apriltag_detection_t *det0;
-            zarray_get(detections, i0, &det0);
-
-            for (int k = 0; k < 4; k++)
-                zarray_set(poly0, k, det0->p[k], NULL);
-
-            for (int i1 = i0+1; i1 < zarray_size(detections); i1++) {
-
-                apriltag_detection_t *det1;
-                zarray_get(detections, i1, &det1);
-
-                if (det0->id != det1->id || det0->family != det1->family)
-                    continue;
-
-                for (int k = 0; k < 4; k++)
-                    zarray_set(poly1, k, det1->p[k], NULL);
-
-                if (g2d_polygon_overlaps_polygon(poly0, poly1)) {
-                    // the tags overlap. Delete one, keep the other.
-
-                    int pref = 0; // 0 means undecided which one we'll keep.
-                    pref = prefer_smaller(pref, det0->hamming, det1->hamming);     // want small hamming
-                    pref = prefer_smaller(pref, -det0->decision_margin, -det1->decision_margin);      // want bigger margins
-                    pref = prefer_smaller(pref, -det0->goodness, -det1->goodness); // want bigger goodness
-
-                    // if we STILL don't prefer one detection over the other, then pick
-                    // any deterministic criterion.
-                    for (int i = 0; i < 4; i++) {
-                        pref = prefer_smaller(pref, det0->p[i][0], det1->p[i][0]);
-                        pref = prefer_smaller(pref, det0->p[i][1], det1->p[i][1]);
-                    }
-
-                    if (pref == 0) {
-                        // at this point, we should only be undecided if the tag detections
-                        // are *exactly* the same. How would that happen?
-                        printf("uh oh, no preference for overlappingdetection\n");
-                    }
-
-                    if (pref < 0) {
-                        // keep det0, destroy det1
-                        apriltag_detection_destroy(det1);
-                        zarray_remove_index(detections, i1, 1);
-                        i1--; // retry the same index
-                        goto retry1;
-                    } else {
-                        // keep det1, destroy det0
-                        apriltag_detection_destroy(det0);
-                        zarray_remove_index(detections, i0, 1);
-                        i0--; // retry the same index.
-                        goto retry0;
-                    }
-                }
-
-              retry1: ;
-            }
-
-          retry0: ;
-        }
-
-        zarray_destroy(poly0);
-        zarray_destroy(poly1);
-    }
+    reconcile_detections(td, detections);
 
     timeprofile_stamp(td->tp, "reconcile");
 
@@ -1383,7 +3055,7 @@ zarray_t *apriltag_detector_detect(apriltag_detector_t *td, image_u8_t *im_orig)
 
         for (int i = 0; i < zarray_size(detections); i++) {
             apriltag_detection_t *det;
-            zarray_get(detections, i, &det);
+            zarray_get_volatile(detections, i, &det);
 
             float rgb[3];
             int bias = 100;
@@ -1420,7 +3092,7 @@ zarray_t *apriltag_detector_detect(apriltag_detector_t *td, image_u8_t *im_orig)
 
         for (int i = 0; i < zarray_size(detections); i++) {
             apriltag_detection_t *det;
-            zarray_get(detections, i, &det);
+            zarray_get_volatile(detections, i, &det);
 
             float rgb[3];
             int bias = 100;
@@ -1485,18 +3157,28 @@ zarray_t *apriltag_detector_detect(apriltag_detector_t *td, image_u8_t *im_orig)
 
     timeprofile_stamp(td->tp, "debug output");
 
-    for (int i = 0; i < zarray_size(quads); i++) {
-        struct quad *quad;
-        zarray_get_volatile(quads, i, &quad);
-        matd_destroy(quad->H);
-        matd_destroy(quad->Hinv);
-    }
-
     zarray_destroy(quads);
 
-    zarray_sort(detections, detection_compare_function);
+    td->stats.ndetections = zarray_size(detections);
+
     timeprofile_stamp(td->tp, "cleanup");
+}
+
+zarray_t *apriltag_detector_detect(apriltag_detector_t *td, image_u8_t *im_orig)
+{
+    zarray_t *values = zarray_create(sizeof(apriltag_detection_t));
+    apriltag_detector_detect_into(td, im_orig, values);
+
+    zarray_t *detections = zarray_create(sizeof(apriltag_detection_t*));
+    zarray_ensure_capacity(detections, zarray_size(values));
+
+    for (int i = 0; i < zarray_size(values); i++) {
+        apriltag_detection_t *det = malloc(sizeof(apriltag_detection_t));
+        zarray_get(values, i, det);
+        zarray_add(detections, &det);
+    }
 
+    zarray_destroy(values);
     return detections;
 }
 
@@ -1514,7 +3196,7 @@ void apriltag_detections_destroy(zarray_t *detections)
     zarray_destroy(detections);
 }
 
-image_u8_t *apriltag_to_image(apriltag_family_t *fam, int idx)
+image_u8_t *apriltag_to_image(const apriltag_family_t *fam, int idx)
 {
     assert(fam != NULL);
     assert(idx >= 0 && idx < fam->ncodes);
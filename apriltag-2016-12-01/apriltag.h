@@ -58,7 +58,10 @@ struct quad
 
     // H: tag coordinates ([-1,1] at the black corners) to pixels
     // Hinv: pixels to tag
-    matd_t *H, *Hinv;
+    //
+    // Both are row-major 3x3 matrices stored inline, so that quads
+    // can be copied by value. See homography33_project().
+    double H[9], Hinv[9];
 };
 
 // Represents a tag family. Every tag belongs to a tag family. Tag
@@ -71,8 +74,9 @@ struct apriltag_family
     // How many codes are there in this tag family?
     uint32_t ncodes;
 
-    // The codes in the family.
-    uint64_t *codes;
+    // The codes in the family. The shipped families point this at
+    // constant data (see e.g. tag36h11_family()).
+    const uint64_t *codes;
 
     // how wide (in bit-sizes) is the black border? (usually 1)
     uint32_t black_border;
@@ -84,14 +88,148 @@ struct apriltag_family
     uint32_t h;
 
     // a human-readable name, e.g., "tag36h11"
-    char *name;
+    const char *name;
 
     // some detector implementations may preprocess codes in order to
     // accelerate decoding.  They put their data here. (Do not use the
     // same apriltag_family instance in more than one implementation)
+    //
+    // Unused by this detector, which keeps its preprocessed codes in
+    // an apriltag_decode_index_t so that families need not be mutated.
     void *impl;
 };
 
+// A precomputed, shareable index for decoding the codes of one tag
+// family. See apriltag_decode_index_create().
+typedef struct apriltag_decode_index apriltag_decode_index_t;
+
+
+// How fit_quad() segments the boundary points of a cluster into four
+// edges. See apriltag_quad_thresh_params.segment_mode.
+enum apriltag_segment_mode
+{
+    // Exhaustively try every 4-subset of the (at most max_nmaxima)
+    // strongest corner candidates. O(sz + nmaxima^4). The default.
+    APRILTAG_SEGMENT_MAXIMA = 0,
+
+    // Greedy agglomerative merge of line segments using a heap.
+    // O(sz log sz), independent of max_nmaxima.
+    APRILTAG_SEGMENT_AGG = 1,
+
+    // Pick whichever of the above is expected to be cheaper, per
+    // cluster, based on the cluster size and max_nmaxima.
+    APRILTAG_SEGMENT_AUTO = 2,
+};
+
+// How refine_pose improves the corners of a quad. See
+// apriltag_detector.refine_pose_mode.
+enum apriltag_refine_pose_mode
+{
+    // Hill-climb each corner in turn, in decreasing step sizes, to
+    // maximize the contrast around the border (quad_goodness). The
+    // default.
+    APRILTAG_REFINE_POSE_HILL_CLIMB = 0,
+
+    // Fit all eight corner coordinates jointly to a blurred step edge
+    // model of the outer black border by Levenberg-Marquardt. Faster,
+    // and generally more accurate on sharp images.
+    APRILTAG_REFINE_POSE_GAUSS_NEWTON = 1,
+};
+
+// How the decoder samples the image at the border and bit cells of a
+// quad. See apriltag_detector.decode_sampling.
+enum apriltag_decode_sampling
+{
+    // Read the pixel containing each cell center. The default.
+    APRILTAG_DECODE_SAMPLING_NEAREST = 0,
+
+    // Interpolate bilinearly between the four pixel centers around
+    // each cell center. Slightly slower, but less sensitive to the
+    // exact position of small tags.
+    APRILTAG_DECODE_SAMPLING_BILINEAR = 1,
+};
+
+// Per-strategy segmentation statistics, indexed by
+// APRILTAG_SEGMENT_MAXIMA and APRILTAG_SEGMENT_AGG.
+struct apriltag_segment_stats
+{
+    // how many clusters were given to the strategy?
+    uint32_t nclusters[2];
+
+    // how many of those were successfully split into four edges?
+    uint32_t nsegmented[2];
+
+    // how many of those survived the remaining checks in fit_quad?
+    uint32_t naccepted[2];
+
+    // total time spent in the strategy, summed over all threads.
+    int64_t utime[2];
+};
+
+// Where did quad candidates get rejected during the last processed
+// frame? Every cluster is counted at most once in the fit_quad stage
+// counters. Decoding is a cascade counted once per (quad, tag
+// geometry) pair, except for the final lookup, which is counted once
+// per (quad, decode index) pair.
+struct apriltag_quad_stats
+{
+    // how many clusters of boundary points were found?
+    uint32_t nclusters;
+
+    // rejected before fitting: fewer than qtp.min_cluster_pixels (or
+    // fewer than 4 distinct) points, or larger than the largest
+    // possible perimeter.
+    uint32_t ntoo_few_pixels;
+    uint32_t ntoo_many_pixels;
+
+    // the gradient points the wrong way, i.e., the black border would
+    // be outside the white border (dot < 0).
+    uint32_t nwrong_orientation;
+
+    // the segmentation strategy could not find four corners.
+    uint32_t nsegment_failed;
+
+    // an edge's line fit exceeded qtp.max_line_fit_mse.
+    uint32_t nline_fit_mse;
+
+    // two adjacent edges were (nearly) parallel.
+    uint32_t ndegenerate;
+
+    // the quad was too small.
+    uint32_t narea;
+
+    // a corner angle was outside qtp.critical_rad, or the angles did
+    // not add up to 2*pi.
+    uint32_t nangle;
+
+    // the quad's homography could not be computed or inverted.
+    uint32_t nhomography_failed;
+
+    // a few samples of the white border were not brighter than the
+    // black border by qtp.min_white_black_diff. Only checked when
+    // decode_early_reject is set.
+    uint32_t nborder_rejected;
+
+    // the border gray models were inconsistent, or the decision
+    // margin of the data bits was (or, with decode_early_reject, could
+    // no longer become) less than min_decision_margin.
+    uint32_t nmargin_rejected;
+
+    // the code was not found in a decode index.
+    uint32_t ndecode_failed;
+
+    // how many times refine_pose and refine_decode were run (once per
+    // quad and family). See decode_first.
+    uint32_t nrefine_pose;
+    uint32_t nrefine_decode;
+
+    // an overlapping, less preferable detection of the same tag was
+    // discarded.
+    uint32_t nduplicates;
+
+    // how many detections were returned?
+    uint32_t ndetections;
+};
 
 struct apriltag_quad_thresh_params
 {
@@ -122,6 +260,10 @@ struct apriltag_quad_thresh_params
     // should the thresholded image be deglitched? Only useful for
     // very noisy images
     int deglitch;
+
+    // which corner segmentation strategy to use? One of enum
+    // apriltag_segment_mode.
+    int segment_mode;
 };
 
 // Represents a detector object. Upon creating a detector, all fields
@@ -174,6 +316,37 @@ struct apriltag_detector
     // computed.
     int refine_pose;
 
+    // How refine_pose refines the corners; one of enum
+    // apriltag_refine_pose_mode. Goodness is computed either way.
+    int refine_pose_mode;
+
+    // How is the image sampled at the border and bit cells of a quad
+    // when decoding it? One of enum apriltag_decode_sampling.
+    int decode_sampling;
+
+    // Quads whose decision margin (see apriltag_detection) is below
+    // this are not decoded. The default, 0, accepts every quad whose
+    // border looks like a tag.
+    float min_decision_margin;
+
+    // When non-zero, quads are rejected as early as possible: first by
+    // comparing a few samples of the white and black borders, before
+    // any refine_pose or refine_decode work, then while reading the
+    // data bits, as soon as min_decision_margin cannot be reached. See
+    // stats for how many quads each level rejects. The border test can
+    // reject a few quads that refinement would have rescued.
+    int decode_early_reject;
+
+    // When non-zero, each quad is first decoded as found, and only
+    // then refined: refine_pose runs only on quads that decode, and
+    // refine_decode only on near misses, whose code is within a couple
+    // of bits of the decode index's maximum hamming distance or whose
+    // decision margin is just below min_decision_margin. Most quads
+    // are not tags, so this is much faster with refinement enabled,
+    // though a few tags that only refine_pose would have made
+    // decodable are lost. The default, 0, refines every quad first.
+    int decode_first;
+
     // When non-zero, write a variety of debugging images to the
     // current working directory at various stages through the
     // detection process. (Somewhat slow).
@@ -185,10 +358,14 @@ struct apriltag_detector
     // Statistics relating to last processed frame
     timeprofile_t *tp;
 
+    // XXX nedges and nsegments are not computed; see stats instead.
     uint32_t nedges;
     uint32_t nsegments;
     uint32_t nquads;
 
+    struct apriltag_quad_stats stats;
+    struct apriltag_segment_stats segment_stats;
+
     ///////////////////////////////////////////////////////////////
     // Internal variables below
 
@@ -197,20 +374,33 @@ struct apriltag_detector
     // tag family passed into the constructor.
     zarray_t *tag_families;
 
+    // apriltag_decode_index_t*, one per entry of tag_families. The
+    // detector holds a reference to each.
+    zarray_t *decode_indexes;
+
     // Used to manage multi-threading.
     workerpool_t *wp;
 
+    // Scratch space reused from frame to frame: a zarray_t* of
+    // apriltag_detection_t for each decode task, and the entries
+    // sorted by reconcile_detections().
+    zarray_t *task_detections;
+    zarray_t *reconcile_entries;
+
     // Used for thread safety.
     pthread_mutex_t mutex;
 };
 
-// Represents the detection of a tag. These are returned to the user
-// and must be individually destroyed by the user.
+// Represents the detection of a tag. apriltag_detector_detect()
+// returns them individually allocated, and they must be individually
+// destroyed by the user; apriltag_detector_detect_into() returns them
+// by value. A detection holds no other allocations, so it can be
+// copied freely.
 typedef struct apriltag_detection apriltag_detection_t;
 struct apriltag_detection
 {
     // a pointer for convenience. not freed by apriltag_detection_destroy.
-    apriltag_family_t *family;
+    const apriltag_family_t *family;
 
     // The decoded ID of the tag
     int id;
@@ -237,9 +427,9 @@ struct apriltag_detection
 
     // The 3x3 homography matrix describing the projection from an
     // "ideal" tag (with corners at (-1,-1), (1,-1), (1,1), and (-1,
-    // 1)) to pixels in the image. This matrix will be freed by
-    // apriltag_detection_destroy.
-    matd_t *H;
+    // 1)) to pixels in the image, stored row-major. Use
+    // apriltag_detection_get_H() if you need it as a matd_t.
+    double H[9];
 
     // The center of the detection in image pixel coordinates.
     double c[2];
@@ -252,20 +442,135 @@ struct apriltag_detection
 // don't forget to add a family!
 apriltag_detector_t *apriltag_detector_create();
 
-// add a family to the apriltag detector. caller still "owns" the family.
-// a single instance should only be provided to one apriltag detector instance.
-void apriltag_detector_add_family_bits(apriltag_detector_t *td, apriltag_family_t *fam, int bits_corrected);
+// How quad codes are matched against the codes of a family. Both
+// decoders try the four rotations of a quad's code in order, 0 to 3,
+// and decode it in the first rotation that is within range of any
+// code, even if a later rotation is closer to another code.
+enum apriltag_decoder
+{
+    // TABLE up to 2 bits corrected, MULTI_INDEX beyond.
+    APRILTAG_DECODER_AUTO = 0,
+
+    // A hash table of every codeword within bits_corrected of a code,
+    // in all four orientations: a single probe per quad, but memory
+    // grows as 4 * ncodes * (d*d choose bits_corrected). At most 3 bits.
+    APRILTAG_DECODER_TABLE,
+
+    // Multi-index hashing on bits_corrected+1 bit substrings of the
+    // code, with popcount verification of the candidates. Memory does
+    // not depend on bits_corrected; latency grows slowly with it.
+    // When several codes are within range of that first rotation,
+    // returns the closest one (the table returns the lowest id).
+    APRILTAG_DECODER_MULTI_INDEX,
+};
 
-// Tunable, but really, 2 is a good choice. Values of >=3
-// consume prohibitively large amounts of memory, and otherwise
-// you want the largest value possible.
-static inline void apriltag_detector_add_family(apriltag_detector_t *td, apriltag_family_t *fam)
+// Builds the decode index of a family. The index is immutable once
+// built and may be used concurrently by any number of detectors and
+// threads. It is reference counted: the creator holds one reference,
+// each detector it is added to holds another, and it is freed when
+// the last reference is released. fam must outlive the index.
+apriltag_decode_index_t *apriltag_decode_index_create(const apriltag_family_t *fam, int bits_corrected,
+                                                      enum apriltag_decoder decoder);
+
+// Builds one index that decodes any of several families, so that a
+// quad is matched against all of them with a single lookup. The
+// families must have the same d and black_border, and at most 65534
+// codes in total; returns NULL otherwise. When a code is within range
+// of codes of several families, the earlier family in fams wins.
+apriltag_decode_index_t *apriltag_decode_index_create_families(const apriltag_family_t *const *fams, int nfams,
+                                                               int bits_corrected, enum apriltag_decoder decoder);
+
+// adds a reference to index and returns it.
+apriltag_decode_index_t *apriltag_decode_index_retain(apriltag_decode_index_t *index);
+
+// drops a reference to index, destroying it if it was the last one.
+void apriltag_decode_index_release(apriltag_decode_index_t *index);
+
+// the families that index decodes.
+int apriltag_decode_index_get_nfamilies(const apriltag_decode_index_t *index);
+const apriltag_family_t *apriltag_decode_index_get_family(const apriltag_decode_index_t *index, int idx);
+
+// Decodes the d*d bits read from a quad (in the order used by the
+// families' codes). Returns the id and sets its family, the number of
+// corrected bits and the number of quarter turns that matched, or
+// returns -1.
+int apriltag_decode_index_decode(const apriltag_decode_index_t *index, uint64_t rcode,
+                                 const apriltag_family_t **family, int *hamming, int *rotation);
+
+// Size and shape of a decode index.
+//
+// APRILTAG_DECODER_TABLE: every codeword within maxhamming bits of a
+// rotation of a family code occupies one 8-byte slot; slots are
+// grouped into 64-byte buckets, and a probe reads one bucket.
+//
+// APRILTAG_DECODER_MULTI_INDEX: every code has one entry per
+// substring, and the probe lengths count the candidate codes
+// examined per substring.
+struct apriltag_decode_index_info
+{
+    enum apriltag_decoder decoder;
+    int maxhamming;
+
+    uint32_t nentries;  // occupied slots
+    uint32_t capacity;  // allocated slots
+    size_t nbytes;
+
+    // number of buckets read when looking up a stored codeword
+    double avg_probe_length;
+    int max_probe_length;
+};
+
+void apriltag_decode_index_get_info(const apriltag_decode_index_t *index,
+                                    struct apriltag_decode_index_info *info);
+
+// Writes index to a versioned binary file, so that later processes
+// can load it instead of building it. Returns 0 on success.
+int apriltag_decode_index_save(const apriltag_decode_index_t *index, const char *path);
+
+// Memory-maps an index written by apriltag_decode_index_save()
+// read-only: loading costs only page faults, and processes loading the
+// same file share its pages. Returns a new index with one reference,
+// or NULL if the file is missing, was written by an incompatible
+// version or byte order, or was built for a different family (the
+// caller should then create the index and save it again). The file
+// is trusted beyond these checks.
+apriltag_decode_index_t *apriltag_decode_index_load(const apriltag_family_t *fam, const char *path);
+
+// loads an index written for apriltag_decode_index_create_families().
+apriltag_decode_index_t *apriltag_decode_index_load_families(const apriltag_family_t *const *fams, int nfams,
+                                                             const char *path);
+
+// add the families of index to the detector, which takes a reference
+// to index. Detectors sharing an index share its memory.
+//
+// Each quad is sampled once per distinct (d, black_border) among the
+// detector's families, then looked up in each index of that geometry.
+// Putting families of the same geometry in one index thus decodes
+// them all with one lookup; a quad then decodes as at most one of
+// them.
+void apriltag_detector_add_family_index(apriltag_detector_t *td, apriltag_decode_index_t *index);
+
+// add a family to the apriltag detector, building a decode index for
+// this detector alone. caller still "owns" the family.
+void apriltag_detector_add_family_bits(apriltag_detector_t *td, const apriltag_family_t *fam, int bits_corrected);
+
+// like apriltag_detector_add_family_bits(), with an explicit choice of
+// decoder. Returns non-zero, and adds nothing, if the decode index
+// cannot be built (see apriltag_decode_index_create()).
+int apriltag_detector_add_family_decoder(apriltag_detector_t *td, const apriltag_family_t *fam,
+                                         int bits_corrected, enum apriltag_decoder decoder);
+
+// Tunable, but really, 2 is a good choice. Larger values correct
+// more bit errors at the cost of more false positives; beyond 2 the
+// multi-index decoder is used, since the table would consume
+// prohibitively large amounts of memory.
+static inline void apriltag_detector_add_family(apriltag_detector_t *td, const apriltag_family_t *fam)
 {
     apriltag_detector_add_family_bits(td, fam, 2);
 }
 
 // does not deallocate the family.
-void apriltag_detector_remove_family(apriltag_detector_t *td, apriltag_family_t *fam);
+void apriltag_detector_remove_family(apriltag_detector_t *td, const apriltag_family_t *fam);
 
 // unregister all families, but does not deallocate the underlying tag family objects.
 void apriltag_detector_clear_families(apriltag_detector_t *td);
@@ -278,17 +583,33 @@ void apriltag_detector_destroy(apriltag_detector_t *td);
 // apriltag_detection_t*. You can use apriltag_detections_destroy to
 // free the array and the detections it contains, or call
 // _detection_destroy and zarray_destroy yourself.
+//
+// The order of the returned detections is deterministic for a given
+// image and configuration (including nthreads), but it is not sorted
+// by id.
 zarray_t *apriltag_detector_detect(apriltag_detector_t *td, image_u8_t *im_orig);
 
+// Like apriltag_detector_detect(), but the detections are written by
+// value into detections, a zarray_t of apriltag_detection_t (not
+// pointers), which is cleared first. Nothing is allocated per
+// detection, and when the same array is passed frame after frame,
+// producing the output does no heap allocation once it (and the
+// detector's scratch space) has grown to fit.
+void apriltag_detector_detect_into(apriltag_detector_t *td, image_u8_t *im_orig, zarray_t *detections);
+
 // Call this method on each of the tags returned by apriltag_detector_detect
 void apriltag_detection_destroy(apriltag_detection_t *det);
 
+// Returns a newly allocated copy of det->H as a 3x3 matd_t. The
+// caller must matd_destroy() it.
+matd_t *apriltag_detection_get_H(const apriltag_detection_t *det);
+
 // destroys the array AND the detections within it.
 void apriltag_detections_destroy(zarray_t *detections);
 
 // Renders the apriltag with with 1px white border.
 // Caller is responsible for calling image_u8_destroy on the image
-image_u8_t *apriltag_to_image(apriltag_family_t *fam, int idx);
+image_u8_t *apriltag_to_image(const apriltag_family_t *fam, int idx);
 
 #ifdef __cplusplus
 }
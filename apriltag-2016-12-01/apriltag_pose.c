@@ -0,0 +1,783 @@
+/* Copyright (C) 2013-2016, The Regents of The University of Michigan.
+All rights reserved.
+
+This software was developed in the APRIL Robotics Lab under the
+direction of Edwin Olson, ebolson@umich.edu. This software may be
+available under alternative licensing terms; contact the address above.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those
+of the authors and should not be interpreted as representing official policies,
+either expressed or implied, of the Regents of The University of Michigan.
+*/
+
+#include "apriltag_pose.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common/matd.h"
+#include "common/math_util.h"
+#include "common/workerpool.h"
+
+// Orthogonal iteration converges globally but only linearly, slowly
+// where the pose is poorly determined, so after a few iterations
+// Levenberg-Marquardt finishes the job. Each stops when an iteration
+// reduces its error by less than POSE_CONVERGENCE of it.
+#define POSE_MAX_OI_ITERS 20
+#define POSE_MAX_LM_ITERS 10
+#define POSE_CONVERGENCE 1e-10
+
+// apriltag_detections_estimate_pose() keeps its tasks on the stack.
+#define POSE_MAX_TASKS 256
+
+static inline double dot3(const double *a, const double *b)
+{
+    return a[0]*b[0] + a[1]*b[1] + a[2]*b[2];
+}
+
+// Sets R to the rotation whose first two columns are the orthonormal
+// pair nearest to a and b (the polar factor of the 3x2 matrix [a b]),
+// and whose third is their cross product. The polar factor is
+// [a b] S^-1/2, with S = [a b]'[a b], and the square root of a 2x2
+// positive definite S is (S + sqrt(det S) I) / sqrt(trace S + 2 sqrt(det S)).
+// Returns non-zero if a and b are parallel.
+static int rotation_from_columns(const double a[3], const double b[3], double R[9])
+{
+    double saa = dot3(a, a), sab = dot3(a, b), sbb = dot3(b, b);
+    double det = saa*sbb - sab*sab;
+    if (!(det > 0))
+        return -1;
+
+    double d = sqrt(det);
+    double tau = sqrt(saa + sbb + 2*d);
+
+    // S^-1/2 = tau * (S + d I)^-1, and det(S + d I) = d * tau^2.
+    double i00 = (sbb + d) / (d * tau);
+    double i01 = -sab / (d * tau);
+    double i11 = (saa + d) / (d * tau);
+
+    double r1[3], r2[3];
+    for (int k = 0; k < 3; k++) {
+        r1[k] = a[k]*i00 + b[k]*i01;
+        r2[k] = a[k]*i01 + b[k]*i11;
+    }
+
+    for (int k = 0; k < 3; k++) {
+        R[3*k + 0] = r1[k];
+        R[3*k + 1] = r2[k];
+        R[3*k + 2] = r1[(k+1)%3]*r2[(k+2)%3] - r1[(k+2)%3]*r2[(k+1)%3];
+    }
+
+    return 0;
+}
+
+// Returns the sum of squared reprojection errors of the n points P
+// (object frame) against p (pixels) for the pose R, t, or HUGE_VAL if
+// a point is not in front of the camera. If JtJ is not NULL, also
+// accumulates the Gauss-Newton normal equations for an update
+// (w, dt) that takes R to exp([w]x) R and t to t + dt.
+static double pose_normal_equations(const apriltag_pose_params_t *params, const double (*P)[3], const double (*p)[2], int n,
+                                    const double R[9], const double t[3], double JtJ[36], double Jtr[6])
+{
+    double fx = params->fx, fy = params->fy;
+    double cost = 0;
+
+    if (JtJ) {
+        memset(JtJ, 0, 36*sizeof(double));
+        memset(Jtr, 0, 6*sizeof(double));
+    }
+
+    for (int i = 0; i < n; i++) {
+        double RP[3], X[3];
+        for (int k = 0; k < 3; k++) {
+            RP[k] = dot3(&R[3*k], P[i]);
+            X[k] = RP[k] + t[k];
+        }
+
+        if (!(X[2] > 0))
+            return HUGE_VAL;
+
+        double iz = 1.0 / X[2];
+        double r[2] = { fx*X[0]*iz + params->cx - p[i][0],
+                        fy*X[1]*iz + params->cy - p[i][1] };
+        cost += r[0]*r[0] + r[1]*r[1];
+
+        if (JtJ == NULL)
+            continue;
+
+        // gradients of the projection with respect to X
+        double g[2][3] = { { fx*iz, 0, -fx*X[0]*iz*iz },
+                           { 0, fy*iz, -fy*X[1]*iz*iz } };
+
+        for (int d = 0; d < 2; d++) {
+            // dX/dw = -[RP]x, so g . dX/dw = RP x g.
+            double J[6] = { RP[1]*g[d][2] - RP[2]*g[d][1],
+                            RP[2]*g[d][0] - RP[0]*g[d][2],
+                            RP[0]*g[d][1] - RP[1]*g[d][0],
+                            g[d][0], g[d][1], g[d][2] };
+
+            for (int j = 0; j < 6; j++) {
+                Jtr[j] += J[j] * r[d];
+                for (int k = 0; k <= j; k++)
+                    JtJ[6*j + k] += J[j] * J[k];
+            }
+        }
+    }
+
+    if (JtJ) {
+        for (int j = 0; j < 6; j++)
+            for (int k = j + 1; k < 6; k++)
+                JtJ[6*j + k] = JtJ[6*k + j];
+    }
+
+    return cost;
+}
+
+// Refines the pose R, t by at most max_iters iterations of
+// Levenberg-Marquardt on the reprojection error of the n points P
+// (object frame) against p (pixels), adding the iterations to
+// *niters. Returns the sum of squared errors.
+static double pose_levenberg_marquardt(const apriltag_pose_params_t *params, const double (*P)[3], const double (*p)[2], int n,
+                                       double R[9], double t[3], int max_iters, int *niters)
+{
+    double JtJ[36], Jtr[6];
+    double cost = pose_normal_equations(params, P, p, n, R, t, JtJ, Jtr);
+    double lambda = 1e-3;
+
+    for (int iter = 0; iter < max_iters && cost > 0 && cost < HUGE_VAL; iter++) {
+        double A[36], delta[6];
+        memcpy(A, JtJ, sizeof(A));
+        for (int j = 0; j < 6; j++) {
+            A[7*j] *= 1 + lambda;
+            delta[j] = -Jtr[j];
+        }
+
+        if (matd_sym_solve(A, delta, 6))
+            break;
+
+        double theta = sqrt(dot3(delta, delta));
+        double dR[9] = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
+        if (theta > 0) {
+            // Rodrigues' formula
+            double k[3] = { delta[0] / theta, delta[1] / theta, delta[2] / theta };
+            double c = cos(theta), s = sin(theta);
+
+            for (int r = 0; r < 3; r++)
+                for (int q = 0; q < 3; q++)
+                    dR[3*r + q] = (r == q ? c : 0) + (1 - c)*k[r]*k[q];
+            dR[1] -= s*k[2]; dR[3] += s*k[2];
+            dR[2] += s*k[1]; dR[6] -= s*k[1];
+            dR[5] -= s*k[0]; dR[7] += s*k[0];
+        }
+
+        double Rnext[9], tnext[3] = { t[0] + delta[3], t[1] + delta[4], t[2] + delta[5] };
+        matd33_multiply(dR, R, Rnext);
+
+        (*niters)++;
+
+        double next_cost = pose_normal_equations(params, P, p, n, Rnext, tnext, NULL, NULL);
+        if (next_cost >= cost) {
+            lambda *= 10;
+            continue;
+        }
+
+        memcpy(R, Rnext, sizeof(Rnext));
+        memcpy(t, tnext, sizeof(tnext));
+        lambda *= 0.1;
+
+        if (cost - next_cost <= POSE_CONVERGENCE * cost) {
+            cost = next_cost;
+            break;
+        }
+
+        cost = pose_normal_equations(params, P, p, n, R, t, JtJ, Jtr);
+    }
+
+    return cost;
+}
+
+void apriltag_detection_estimate_pose(const apriltag_detection_t *det, const apriltag_pose_params_t *params,
+                                      double tagsize, apriltag_pose_t *pose)
+{
+    double fx = params->fx, fy = params->fy, cx = params->cx, cy = params->cy;
+    double h = tagsize / 2;
+
+    memset(pose, 0, sizeof(*pose));
+    pose->R[0] = pose->R[4] = pose->R[8] = 1;
+    pose->reprojection_error = HUGE_VAL;
+
+    // The corners of the tag in the tag frame, in the order of det->p
+    // (see quad_decode_task()).
+    double P[4][3];
+    for (int i = 0; i < 4; i++) {
+        P[i][0] = h * ((i == 1 || i == 2) ? 1 : -1);
+        P[i][1] = h * ((i < 2) ? 1 : -1);
+        P[i][2] = 0;
+    }
+
+    // Initial estimate: with K the camera matrix, K^-1 H is
+    // proportional to [r1 r2 t/h]. As in homography_to_pose(), the
+    // scale is the geometric mean of the lengths of the first two
+    // columns, and its sign puts the tag in front of the camera.
+    double m[3][3];
+    for (int j = 0; j < 3; j++) {
+        m[j][0] = (det->H[j] - cx*det->H[6 + j]) / fx;
+        m[j][1] = (det->H[3 + j] - cy*det->H[6 + j]) / fy;
+        m[j][2] = det->H[6 + j];
+    }
+
+    double scale = sqrt(sqrt(dot3(m[0], m[0]) * dot3(m[1], m[1])));
+    if (scale == 0)
+        return;
+    if (m[2][2] < 0)
+        scale = -scale;
+
+    double a[3], b[3], R[9], t[3];
+    for (int k = 0; k < 3; k++) {
+        a[k] = m[0][k] / scale;
+        b[k] = m[1][k] / scale;
+        t[k] = m[2][k] * h / scale;
+    }
+
+    if (rotation_from_columns(a, b, R))
+        return;
+
+    // Orthogonal iteration. V[i] projects onto the line of sight of
+    // corner i; the object-space error is the squared distance of
+    // each corner, R*P[i] + t, from its line of sight. For a given R,
+    // the best t is
+    //
+    //     t = (I - sum V[i] / n)^-1 sum (V[i] - I) R P[i] / n
+    //
+    // and for the points' projections onto their lines of sight, the
+    // best R is an absolute orientation problem.
+    double V[4][9], Vsum[9] = { 0 };
+    for (int i = 0; i < 4; i++) {
+        double v[3] = { (det->p[i][0] - cx) / fx, (det->p[i][1] - cy) / fy, 1 };
+        double vv = dot3(v, v);
+
+        for (int r = 0; r < 3; r++)
+            for (int c = 0; c < 3; c++)
+                V[i][3*r + c] = v[r]*v[c] / vv;
+
+        for (int k = 0; k < 9; k++)
+            Vsum[k] += V[i][k];
+    }
+
+    double A[9], Ainv[9];
+    for (int k = 0; k < 9; k++)
+        A[k] = (k % 4 == 0) - Vsum[k] / 4;
+
+    int niters = 0;
+
+    if (matd33_inverse(A, Ainv) == 0) {
+        double prev_err = 0;
+
+        while (1) {
+            double RP[4][3], s[3] = { 0, 0, 0 };
+
+            for (int i = 0; i < 4; i++) {
+                for (int k = 0; k < 3; k++)
+                    RP[i][k] = dot3(&R[3*k], P[i]);
+
+                for (int k = 0; k < 3; k++)
+                    s[k] += dot3(&V[i][3*k], RP[i]) - RP[i][k];
+            }
+
+            for (int k = 0; k < 3; k++)
+                t[k] = dot3(&Ainv[3*k], s) / 4;
+
+            // q[i] is corner i projected onto its line of sight.
+            double q[4][3], err = 0;
+            for (int i = 0; i < 4; i++) {
+                double X[3] = { RP[i][0] + t[0], RP[i][1] + t[1], RP[i][2] + t[2] };
+
+                for (int k = 0; k < 3; k++) {
+                    q[i][k] = dot3(&V[i][3*k], X);
+                    err += sq(X[k] - q[i][k]);
+                }
+            }
+
+            if (niters == POSE_MAX_OI_ITERS || (niters > 0 && prev_err - err <= POSE_CONVERGENCE * prev_err))
+                break;
+            prev_err = err;
+
+            // The R that best maps the P[i] onto the q[i] maximizes
+            // trace(R' sum (q[i] - qbar) (P[i] - Pbar)'). The P[i]
+            // have z = 0 and are centered on the origin, so only the
+            // first two columns of the sum are non-zero.
+            double qbar[3] = { 0, 0, 0 };
+            for (int i = 0; i < 4; i++)
+                for (int k = 0; k < 3; k++)
+                    qbar[k] += q[i][k] / 4;
+
+            double ca[3] = { 0, 0, 0 }, cb[3] = { 0, 0, 0 };
+            for (int i = 0; i < 4; i++) {
+                for (int k = 0; k < 3; k++) {
+                    ca[k] += (q[i][k] - qbar[k]) * P[i][0];
+                    cb[k] += (q[i][k] - qbar[k]) * P[i][1];
+                }
+            }
+
+            double Rnext[9];
+            if (rotation_from_columns(ca, cb, Rnext))
+                break;
+
+            // R changed, so t is recomputed before the loop exits.
+            memcpy(R, Rnext, sizeof(R));
+            niters++;
+        }
+    }
+
+    double cost = pose_levenberg_marquardt(params, (const double (*)[3]) P, (const double (*)[2]) det->p, 4,
+                                           R, t, POSE_MAX_LM_ITERS, &niters);
+
+    memcpy(pose->R, R, sizeof(R));
+    memcpy(pose->t, t, sizeof(t));
+    pose->reprojection_error = sqrt(cost / 4);
+    pose->niters = niters;
+    pose->ntags = 1;
+}
+
+// detections holds either apriltag_detection_t* or apriltag_detection_t.
+static inline const apriltag_detection_t *detection_at(const zarray_t *detections, int i)
+{
+    const apriltag_detection_t *det;
+    if (detections->el_sz == sizeof(apriltag_detection_t))
+        zarray_get_volatile(detections, i, &det);
+    else
+        zarray_get(detections, i, &det);
+    return det;
+}
+
+static void pose_workerpool_init(apriltag_detector_t *td)
+{
+    if (td->wp == NULL || td->nthreads != workerpool_get_nthreads(td->wp)) {
+        workerpool_destroy(td->wp);
+        td->wp = workerpool_create(td->nthreads);
+    }
+}
+
+// Splits n items into chunks for the worker threads, at most
+// POSE_MAX_TASKS of them.
+static int pose_chunksize(apriltag_detector_t *td, int n)
+{
+    int chunksize = 1 + n / (APRILTAG_TASKS_PER_THREAD_TARGET * td->nthreads);
+    return imax(chunksize, (n + POSE_MAX_TASKS - 1) / POSE_MAX_TASKS);
+}
+
+struct pose_task
+{
+    const zarray_t *detections;
+    const apriltag_pose_params_t *params;
+    apriltag_pose_t *poses;
+    int i0, i1;
+};
+
+static void pose_task(void *p)
+{
+    struct pose_task *task = (struct pose_task*) p;
+    const zarray_t *detections = task->detections;
+    const apriltag_pose_params_t *params = task->params;
+
+    for (int i = task->i0; i < task->i1; i++) {
+        const apriltag_detection_t *det = detection_at(detections, i);
+        double tagsize = params->tagsizes ? params->tagsizes[i] : params->tagsize;
+        apriltag_detection_estimate_pose(det, params, tagsize, &task->poses[i]);
+    }
+}
+
+void apriltag_detections_estimate_pose(apriltag_detector_t *td, const zarray_t *detections,
+                                       const apriltag_pose_params_t *params, apriltag_pose_t *poses)
+{
+    int ndetections = zarray_size(detections);
+    if (ndetections == 0)
+        return;
+
+    pose_workerpool_init(td);
+    int chunksize = pose_chunksize(td, ndetections);
+
+    struct pose_task tasks[POSE_MAX_TASKS];
+    int ntasks = 0;
+
+    for (int i = 0; i < ndetections; i += chunksize) {
+        tasks[ntasks].detections = detections;
+        tasks[ntasks].params = params;
+        tasks[ntasks].poses = poses;
+        tasks[ntasks].i0 = i;
+        tasks[ntasks].i1 = imin(ndetections, i + chunksize);
+
+        workerpool_add_task(td->wp, pose_task, &tasks[ntasks]);
+        ntasks++;
+    }
+
+    workerpool_run(td->wp);
+}
+
+////////////////////////////////////////////////////////////////////
+// Bundles
+
+// A bundle's pose starts from the single-tag poses of this many of
+// its largest visible tags, and from their mirror images. Each start
+// gets a few iterations, and the best is refined to convergence.
+#define BUNDLE_INIT_CANDIDATES 3
+#define BUNDLE_PROBE_LM_ITERS 2
+
+// Starts whose rotations differ by less than this (in the Frobenius
+// norm; about 3 degrees) are tried only once.
+#define BUNDLE_SAME_START 0.15
+
+struct bundle_tag
+{
+    const apriltag_family_t *family;
+    int id;
+
+    double corners[4][3]; // bundle frame, in the order of det->p
+
+    // the tag frame in the bundle frame, and the tag's size
+    double R[9], t[3];
+    double tagsize;
+};
+
+struct apriltag_bundle
+{
+    zarray_t *tags; // struct bundle_tag, sorted by family and id
+
+    // the corners visible in the current frame: double[3] in the
+    // bundle frame and double[2] in the image. Reused from frame to
+    // frame.
+    zarray_t *object_points;
+    zarray_t *image_points;
+};
+
+static int bundle_tag_compare(const void *_a, const void *_b)
+{
+    const struct bundle_tag *a = _a, *b = _b;
+
+    if (a->family != b->family)
+        return (uintptr_t) a->family < (uintptr_t) b->family ? -1 : 1;
+    return a->id - b->id;
+}
+
+static struct bundle_tag *bundle_find(const apriltag_bundle_t *bundle, const apriltag_family_t *family, int id)
+{
+    struct bundle_tag key;
+    key.family = family;
+    key.id = id;
+
+    int lo = 0, hi = zarray_size(bundle->tags) - 1;
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        struct bundle_tag *tag;
+        zarray_get_volatile(bundle->tags, mid, &tag);
+
+        int c = bundle_tag_compare(&key, tag);
+        if (c == 0)
+            return tag;
+        if (c < 0)
+            hi = mid - 1;
+        else
+            lo = mid + 1;
+    }
+
+    return NULL;
+}
+
+apriltag_bundle_t *apriltag_bundle_create(void)
+{
+    apriltag_bundle_t *bundle = calloc(1, sizeof(apriltag_bundle_t));
+    bundle->tags = zarray_create(sizeof(struct bundle_tag));
+    bundle->object_points = zarray_create(sizeof(double[3]));
+    bundle->image_points = zarray_create(sizeof(double[2]));
+    return bundle;
+}
+
+void apriltag_bundle_destroy(apriltag_bundle_t *bundle)
+{
+    if (bundle == NULL)
+        return;
+
+    zarray_destroy(bundle->tags);
+    zarray_destroy(bundle->object_points);
+    zarray_destroy(bundle->image_points);
+    free(bundle);
+}
+
+int apriltag_bundle_add_tag(apriltag_bundle_t *bundle, const apriltag_family_t *family, int id,
+                            const double corners[4][3])
+{
+    struct bundle_tag tag;
+    memset(&tag, 0, sizeof(tag));
+    tag.family = family;
+    tag.id = id;
+    memcpy(tag.corners, corners, sizeof(tag.corners));
+
+    // The tag frame is the rigid fit of the tag's own corners (see
+    // apriltag_detection_estimate_pose()) to the given ones.
+    double edges = 0;
+    for (int i = 0; i < 4; i++) {
+        const double *a = corners[i], *b = corners[(i + 1) % 4];
+        edges += sqrt(sq(a[0] - b[0]) + sq(a[1] - b[1]) + sq(a[2] - b[2]));
+    }
+    tag.tagsize = edges / 4;
+
+    double ca[3] = { 0, 0, 0 }, cb[3] = { 0, 0, 0 };
+    for (int i = 0; i < 4; i++) {
+        for (int k = 0; k < 3; k++) {
+            tag.t[k] += corners[i][k] / 4;
+
+            // the tag's own corner i is (x, y, 0) * tagsize / 2
+            double x = (i == 1 || i == 2) ? 1 : -1, y = (i < 2) ? 1 : -1;
+            ca[k] += corners[i][k] * x;
+            cb[k] += corners[i][k] * y;
+        }
+    }
+
+    if (!(tag.tagsize > 0) || rotation_from_columns(ca, cb, tag.R))
+        return -1;
+
+    struct bundle_tag *existing = bundle_find(bundle, family, id);
+    if (existing) {
+        *existing = tag;
+        return 0;
+    }
+
+    zarray_add(bundle->tags, &tag);
+    zarray_sort(bundle->tags, bundle_tag_compare);
+    return 0;
+}
+
+int apriltag_bundle_add_tag_pose(apriltag_bundle_t *bundle, const apriltag_family_t *family, int id,
+                                 double tagsize, const double R[9], const double t[3])
+{
+    double h = tagsize / 2;
+    double corners[4][3];
+
+    for (int i = 0; i < 4; i++) {
+        double x = h * ((i == 1 || i == 2) ? 1 : -1), y = h * ((i < 2) ? 1 : -1);
+        for (int k = 0; k < 3; k++)
+            corners[i][k] = R[3*k + 0]*x + R[3*k + 1]*y + t[k];
+    }
+
+    return apriltag_bundle_add_tag(bundle, family, id, corners);
+}
+
+// Sets Rflip to the other pose that a small tag at R, t can hardly be
+// told apart from: the tag turned about its center so that its normal
+// is mirrored about the line of sight.
+static void pose_flip(const double R[9], const double t[3], double Rflip[9])
+{
+    double n[3] = { R[2], R[5], R[8] };
+    double tt = sqrt(dot3(t, t));
+    double v[3] = { t[0] / tt, t[1] / tt, t[2] / tt };
+
+    double nv = dot3(n, v);
+    double m[3] = { 2*nv*v[0] - n[0], 2*nv*v[1] - n[1], 2*nv*v[2] - n[2] };
+
+    // rotate n onto m about their common normal.
+    double axis[3] = { n[1]*m[2] - n[2]*m[1], n[2]*m[0] - n[0]*m[2], n[0]*m[1] - n[1]*m[0] };
+    double s = sqrt(dot3(axis, axis)), c = dot3(n, m);
+
+    if (s == 0) {
+        memcpy(Rflip, R, 9*sizeof(double));
+        return;
+    }
+
+    double k[3] = { axis[0] / s, axis[1] / s, axis[2] / s };
+    double F[9];
+    for (int r = 0; r < 3; r++)
+        for (int q = 0; q < 3; q++)
+            F[3*r + q] = (r == q ? c : 0) + (1 - c)*k[r]*k[q];
+    F[1] -= s*k[2]; F[3] += s*k[2];
+    F[2] += s*k[1]; F[6] -= s*k[1];
+    F[5] -= s*k[0]; F[7] += s*k[0];
+
+    matd33_multiply(F, R, Rflip);
+}
+
+static void bundle_estimate_pose(const zarray_t *detections, const apriltag_pose_params_t *params,
+                                 apriltag_bundle_t *bundle, apriltag_pose_t *pose)
+{
+    memset(pose, 0, sizeof(*pose));
+    pose->R[0] = pose->R[4] = pose->R[8] = 1;
+    pose->reprojection_error = HUGE_VAL;
+
+    zarray_clear(bundle->object_points);
+    zarray_clear(bundle->image_points);
+
+    // the largest visible tags, largest first.
+    struct {
+        const apriltag_detection_t *det;
+        const struct bundle_tag *tag;
+        double area;
+    } candidates[BUNDLE_INIT_CANDIDATES];
+    int ncandidates = 0;
+
+    for (int i = 0; i < zarray_size(detections); i++) {
+        const apriltag_detection_t *det = detection_at(detections, i);
+        const struct bundle_tag *tag = bundle_find(bundle, det->family, det->id);
+        if (tag == NULL)
+            continue;
+
+        double area = 0;
+        for (int k = 0; k < 4; k++) {
+            zarray_add(bundle->object_points, tag->corners[k]);
+            zarray_add(bundle->image_points, det->p[k]);
+
+            const double *a = det->p[k], *b = det->p[(k + 1) % 4];
+            area += (a[0]*b[1] - a[1]*b[0]) / 2;
+        }
+        area = fabs(area);
+        pose->ntags++;
+
+        int pos = ncandidates;
+        while (pos > 0 && candidates[pos - 1].area < area) {
+            if (pos < BUNDLE_INIT_CANDIDATES)
+                candidates[pos] = candidates[pos - 1];
+            pos--;
+        }
+
+        if (pos < BUNDLE_INIT_CANDIDATES) {
+            candidates[pos].det = det;
+            candidates[pos].tag = tag;
+            candidates[pos].area = area;
+            ncandidates = imin(ncandidates + 1, BUNDLE_INIT_CANDIDATES);
+        }
+    }
+
+    if (pose->ntags == 0)
+        return;
+
+    int npoints = zarray_size(bundle->object_points);
+    const double (*P)[3], (*p)[2];
+    zarray_get_volatile(bundle->object_points, 0, &P);
+    zarray_get_volatile(bundle->image_points, 0, &p);
+
+    // The bundle frame in the camera frame is the tag's pose times the
+    // inverse of the tag frame in the bundle frame. A small tag's pose
+    // may well be the mirror image of the true one, so each is tried
+    // both ways.
+    double R[9], t[3], cost = HUGE_VAL;
+    int niters = 0;
+
+    // the starts tried so far; tags that agree need not all be tried.
+    double starts[2*BUNDLE_INIT_CANDIDATES][9];
+    int nstarts = 0;
+
+    for (int c = 0; c < ncandidates; c++) {
+        const struct bundle_tag *tag = candidates[c].tag;
+
+        apriltag_pose_t tag_pose;
+        apriltag_detection_estimate_pose(candidates[c].det, params, tag->tagsize, &tag_pose);
+        if (tag_pose.reprojection_error == HUGE_VAL)
+            continue;
+
+        for (int flip = 0; flip < 2; flip++) {
+            double Rtag[9];
+            if (flip)
+                pose_flip(tag_pose.R, tag_pose.t, Rtag);
+            else
+                memcpy(Rtag, tag_pose.R, sizeof(Rtag));
+
+            double Rc[9], tc[3];
+            matd33_multiply_transpose(Rtag, tag->R, Rc);
+            for (int k = 0; k < 3; k++)
+                tc[k] = tag_pose.t[k] - dot3(&Rc[3*k], tag->t);
+
+            int seen = 0;
+            for (int i = 0; i < nstarts && !seen; i++) {
+                double d2 = 0;
+                for (int k = 0; k < 9; k++)
+                    d2 += sq(starts[i][k] - Rc[k]);
+                seen = d2 < sq(BUNDLE_SAME_START);
+            }
+            if (seen)
+                continue;
+            memcpy(starts[nstarts++], Rc, sizeof(Rc));
+
+            double c_cost = pose_levenberg_marquardt(params, P, p, npoints, Rc, tc, BUNDLE_PROBE_LM_ITERS, &niters);
+            if (c_cost < cost) {
+                cost = c_cost;
+                memcpy(R, Rc, sizeof(R));
+                memcpy(t, tc, sizeof(t));
+            }
+        }
+    }
+
+    if (cost == HUGE_VAL)
+        return;
+
+    cost = pose_levenberg_marquardt(params, P, p, npoints, R, t, POSE_MAX_LM_ITERS, &niters);
+
+    memcpy(pose->R, R, sizeof(R));
+    memcpy(pose->t, t, sizeof(t));
+    pose->reprojection_error = sqrt(cost / npoints);
+    pose->niters = niters;
+}
+
+struct bundle_task
+{
+    const zarray_t *detections;
+    const apriltag_pose_params_t *params;
+    apriltag_bundle_t **bundles;
+    apriltag_pose_t *poses;
+    int i0, i1;
+};
+
+static void bundle_task(void *p)
+{
+    struct bundle_task *task = (struct bundle_task*) p;
+
+    for (int i = task->i0; i < task->i1; i++)
+        bundle_estimate_pose(task->detections, task->params, task->bundles[i], &task->poses[i]);
+}
+
+void apriltag_bundles_estimate_pose(apriltag_detector_t *td, const zarray_t *detections,
+                                    const apriltag_pose_params_t *params,
+                                    apriltag_bundle_t **bundles, int nbundles, apriltag_pose_t *poses)
+{
+    if (nbundles == 0)
+        return;
+
+    pose_workerpool_init(td);
+    int chunksize = pose_chunksize(td, nbundles);
+
+    struct bundle_task tasks[POSE_MAX_TASKS];
+    int ntasks = 0;
+
+    for (int i = 0; i < nbundles; i += chunksize) {
+        tasks[ntasks].detections = detections;
+        tasks[ntasks].params = params;
+        tasks[ntasks].bundles = bundles;
+        tasks[ntasks].poses = poses;
+        tasks[ntasks].i0 = i;
+        tasks[ntasks].i1 = imin(nbundles, i + chunksize);
+
+        workerpool_add_task(td->wp, bundle_task, &tasks[ntasks]);
+        ntasks++;
+    }
+
+    workerpool_run(td->wp);
+}
@@ -0,0 +1,152 @@
+/* Copyright (C) 2013-2016, The Regents of The University of Michigan.
+All rights reserved.
+
+This software was developed in the APRIL Robotics Lab under the
+direction of Edwin Olson, ebolson@umich.edu. This software may be
+available under alternative licensing terms; contact the address above.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those
+of the authors and should not be interpreted as representing official policies,
+either expressed or implied, of the Regents of The University of Michigan.
+*/
+
+#ifndef _APRILTAG_POSE_H
+#define _APRILTAG_POSE_H
+
+#include "apriltag.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Camera intrinsics and tag size for apriltag_detections_estimate_pose().
+typedef struct apriltag_pose_params apriltag_pose_params_t;
+struct apriltag_pose_params
+{
+    // Pinhole camera, in pixels: a point (X, Y, Z) in the camera frame
+    // (x right, y down, z forward) projects to (fx*X/Z + cx, fy*Y/Z + cy).
+    double fx, fy, cx, cy;
+
+    // The length of an edge of the tag's black border, in the units
+    // wanted for the translation.
+    double tagsize;
+
+    // If not NULL, tagsizes[i] is used for detection i instead of
+    // tagsize, e.g. when tags of several sizes are in view.
+    const double *tagsizes;
+};
+
+// The pose of one tag: a point X in the tag frame is R*X + t in the
+// camera frame. The tag frame is that of apriltag_detection_t.H,
+// scaled to tag units: the origin is at the center of the tag, x is
+// to the right and y down in the tag as drawn by apriltag_to_image(),
+// and z points into the tag, away from a camera that sees it.
+typedef struct apriltag_pose apriltag_pose_t;
+struct apriltag_pose
+{
+    double R[9]; // row-major rotation
+    double t[3];
+
+    // RMS distance, in pixels, between the detected corners and the
+    // corners of the tag projected with this pose; HUGE_VAL if no pose
+    // with the tag in front of the camera was found.
+    double reprojection_error;
+
+    // orthogonal and Levenberg-Marquardt iterations used.
+    int niters;
+
+    // the number of tags the pose was fit to: 1 for a single tag, the
+    // number of visible tags for a bundle.
+    int ntags;
+};
+
+// Computes the pose of every detection, writing poses[i] for the i'th
+// one. detections may hold either apriltag_detection_t* (from
+// apriltag_detector_detect()) or apriltag_detection_t (from
+// apriltag_detector_detect_into()).
+//
+// Each pose starts from the decomposition of the detection's
+// homography, is refined by a few steps of orthogonal iteration (Lu,
+// Hager and Mjolsness, 2000), which minimizes the distance of the
+// tag's corners from their lines of sight, and then converged by
+// Levenberg-Marquardt on the reprojection error. A small or distant
+// tag often has a second pose, tilted the other way, that fits almost
+// as well; the one nearer the homography's estimate is returned.
+//
+// The detections are split among td's worker threads. Nothing is
+// allocated beyond the worker pool's task list.
+void apriltag_detections_estimate_pose(apriltag_detector_t *td, const zarray_t *detections,
+                                       const apriltag_pose_params_t *params, apriltag_pose_t *poses);
+
+// Estimates the pose of a single detection, in the calling thread.
+void apriltag_detection_estimate_pose(const apriltag_detection_t *det, const apriltag_pose_params_t *params,
+                                      double tagsize, apriltag_pose_t *pose);
+
+// A rigid set of tags, such as a board: the corners of every tag have
+// fixed coordinates in the bundle's own frame, so that one pose can be
+// fit to all of the visible ones at once.
+typedef struct apriltag_bundle apriltag_bundle_t;
+
+apriltag_bundle_t *apriltag_bundle_create(void);
+void apriltag_bundle_destroy(apriltag_bundle_t *bundle);
+
+// Adds the tag (family, id) to the bundle, replacing it if it is
+// already there. corners are the coordinates of its corners in the
+// bundle frame, in the order of apriltag_detection_t.p, and should
+// form a square. Returns non-zero (and adds nothing) if they are
+// degenerate.
+int apriltag_bundle_add_tag(apriltag_bundle_t *bundle, const apriltag_family_t *family, int id,
+                            const double corners[4][3]);
+
+// Adds a tag of the given size whose tag frame (see apriltag_pose_t)
+// is at R, t in the bundle frame. Returns non-zero (and adds nothing)
+// as apriltag_bundle_add_tag() does, e.g. if tagsize is 0.
+int apriltag_bundle_add_tag_pose(apriltag_bundle_t *bundle, const apriltag_family_t *family, int id,
+                                 double tagsize, const double R[9], const double t[3]);
+
+// Fits the pose of each of the nbundles bundles (the bundle frame in
+// the camera frame) to the corners of all of its tags found in
+// detections, writing poses[i] for bundles[i]. detections may hold
+// apriltag_detection_t* or apriltag_detection_t, as for
+// apriltag_detections_estimate_pose(), and only the camera intrinsics
+// of params are used. A bundle with no visible tags gets ntags = 0 and
+// a reprojection_error of HUGE_VAL.
+//
+// The pose starts from the single-tag poses of the largest visible
+// tags, each also mirrored to allow for the ambiguity of a small tag.
+// All of the corners decide between these starts, and the best is
+// refined by Levenberg-Marquardt over every corner, with 6x6 normal
+// equations.
+//
+// The bundles are solved in parallel on td's worker threads, so a
+// bundle may appear only once in bundles. Each bundle keeps scratch
+// space for its corners, which is allocated only as it grows.
+void apriltag_bundles_estimate_pose(apriltag_detector_t *td, const zarray_t *detections,
+                                    const apriltag_pose_params_t *params,
+                                    apriltag_bundle_t **bundles, int nbundles, apriltag_pose_t *poses);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -90,11 +90,19 @@ struct quad_task
 {
     zarray_t *clusters;
     int cidx0, cidx1; // [cidx0, cidx1)
+
+    // quads fit by this task. Each task owns its own output array so
+    // that no locking is required; they are concatenated in task
+    // order once all tasks have finished.
     zarray_t *quads;
     apriltag_detector_t *td;
     int w, h;
 
     image_u8_t *im;
+
+    // accumulated privately by each task and summed afterwards.
+    struct apriltag_quad_stats stats;
+    struct apriltag_segment_stats segment_stats;
 };
 
 struct remove_vertex
@@ -672,9 +680,12 @@ int quad_segment_agg(apriltag_detector_t *td, zarray_t *cluster, struct line_fit
         float err;
 
         int res = zmaxheap_remove_max(heap, &rv, &err);
-        if (!res)
+        if (!res) {
+            free(rvalloc);
+            free(segs);
+            zmaxheap_destroy(heap);
             return 0;
-        assert(res);
+        }
 
         // is this remove_vertex valid? (Or has one of the left/right
         // vertices changes since we last looked?)
@@ -734,14 +745,44 @@ int quad_segment_agg(apriltag_detector_t *td, zarray_t *cluster, struct line_fit
     return 1;
 }
 
+// Decide which segmentation strategy to use for a cluster of sz
+// points. For APRILTAG_SEGMENT_AUTO, we compare rough operation
+// counts: quad_segment_maxima does O(sz) work to find the maxima and
+// then up to C(nmaxima, 4) combinations of line fits, whereas
+// quad_segment_agg performs ~3*sz heap operations, each with a line
+// fit.
+static int quad_segment_choose(apriltag_detector_t *td, int sz)
+{
+    if (td->qtp.segment_mode != APRILTAG_SEGMENT_AUTO)
+        return td->qtp.segment_mode == APRILTAG_SEGMENT_AGG ? APRILTAG_SEGMENT_AGG : APRILTAG_SEGMENT_MAXIMA;
+
+    // quad_segment_maxima rejects these immediately (ksz < 2), and
+    // that's the cheapest possible outcome.
+    if (sz / 12 < 2)
+        return APRILTAG_SEGMENT_MAXIMA;
+
+    // the smoothed error has at most one maximum for every two points.
+    double n = imin(td->qtp.max_nmaxima, sz / 2);
+
+    // XXX Tunable. Relative costs, in units of one fit_line call.
+    double maxima_cost = 6.0*sz + n*(n-1)*(n-2)*(n-3) / 24.0 * 2;
+    double agg_cost = 3.0*sz * (2 + log2(3.0*sz));
+
+    return (agg_cost < maxima_cost) ? APRILTAG_SEGMENT_AGG : APRILTAG_SEGMENT_MAXIMA;
+}
+
 // return 1 if the quad looks okay, 0 if it should be discarded
-int fit_quad(apriltag_detector_t *td, image_u8_t *im, zarray_t *cluster, struct quad *quad)
+int fit_quad(apriltag_detector_t *td, image_u8_t *im, zarray_t *cluster, struct quad *quad,
+             struct apriltag_quad_stats *stats, struct apriltag_segment_stats *segment_stats)
 {
     int res = 0;
+    int segment_mode = -1;
 
     int sz = zarray_size(cluster);
-    if (sz < 4) // can't fit a quad to less than 4 points
+    if (sz < 4) { // can't fit a quad to less than 4 points
+        stats->ntoo_few_pixels++;
         return 0;
+    }
 
     /////////////////////////////////////////////////////////////
     // Step 1. Sort points so they wrap around the center of the
@@ -787,8 +828,10 @@ int fit_quad(apriltag_detector_t *td, image_u8_t *im, zarray_t *cluster, struct
     }
 
     // Ensure that the black border is inside the white border.
-    if (dot < 0)
+    if (dot < 0) {
+        stats->nwrong_orientation++;
         return 0;
+    }
 
     // we now sort the points according to theta. This is a prepatory
     // step for segmenting them into four lines.
@@ -896,8 +939,10 @@ int fit_quad(apriltag_detector_t *td, image_u8_t *im, zarray_t *cluster, struct
 #endif
     }
 
-    if (sz < 4)
+    if (sz < 4) {
+        stats->ntoo_few_pixels++;
         return 0;
+    }
 
     /////////////////////////////////////////////////////////////
     // Step 2. Precompute statistics that allow line fit queries to be
@@ -980,14 +1025,25 @@ int fit_quad(apriltag_detector_t *td, image_u8_t *im, zarray_t *cluster, struct
     }
 
     int indices[4];
-    if (1) {
-        if (!quad_segment_maxima(td, cluster, lfps, indices))
-            goto finish;
-    } else {
-        if (!quad_segment_agg(td, cluster, lfps, indices))
-            goto finish;
+    segment_mode = quad_segment_choose(td, sz);
+
+    int64_t utime0 = utime_now();
+    int segmented;
+    if (segment_mode == APRILTAG_SEGMENT_AGG)
+        segmented = quad_segment_agg(td, cluster, lfps, indices);
+    else
+        segmented = quad_segment_maxima(td, cluster, lfps, indices);
+
+    segment_stats->utime[segment_mode] += utime_now() - utime0;
+    segment_stats->nclusters[segment_mode]++;
+
+    if (!segmented) {
+        stats->nsegment_failed++;
+        goto finish;
     }
 
+    segment_stats->nsegmented[segment_mode]++;
+
 //    printf("%d %d %d %d\n", indices[0], indices[1], indices[2], indices[3]);
 
     if (0) {
@@ -1030,6 +1086,7 @@ int fit_quad(apriltag_detector_t *td, image_u8_t *im, zarray_t *cluster, struct
             fit_line(lfps, sz, i0, i1, lines[i], NULL, &err);
 
             if (err > td->qtp.max_line_fit_mse) {
+                stats->nline_fit_mse++;
                 res = 0;
                 goto finish;
             }
@@ -1061,6 +1118,7 @@ int fit_quad(apriltag_detector_t *td, image_u8_t *im, zarray_t *cluster, struct
             // inverse.
             double W00 = A11 / det, W01 = -A01 / det;
             if (fabs(det) < 0.001) {
+                stats->ndegenerate++;
                 res = 0;
                 goto finish;
             }
@@ -1121,6 +1179,7 @@ int fit_quad(apriltag_detector_t *td, image_u8_t *im, zarray_t *cluster, struct
 //        int d = fam->d + fam->black_border*2;
         int d = 8;
         if (area < d*d) {
+            stats->narea++;
             res = 0;
             goto finish;
         }
@@ -1149,7 +1208,8 @@ int fit_quad(apriltag_detector_t *td, image_u8_t *im, zarray_t *cluster, struct
         }
 
         // looking for 2PI
-        if (total < 6.2 || total > 6.4) {
+        if (res == 0 || total < 6.2 || total > 6.4) {
+            stats->nangle++;
             res = 0;
             goto finish;
         }
@@ -1169,6 +1229,9 @@ int fit_quad(apriltag_detector_t *td, image_u8_t *im, zarray_t *cluster, struct
 
     free(lfps);
 
+    if (res && segment_mode >= 0)
+        segment_stats->naccepted[segment_mode]++;
+
     return res;
 }
 
@@ -1221,8 +1284,10 @@ static void do_quad_task(void *p)
         zarray_t *cluster;
         zarray_get(clusters, cidx, &cluster);
 
-        if (zarray_size(cluster) < td->qtp.min_cluster_pixels)
+        if (zarray_size(cluster) < td->qtp.min_cluster_pixels) {
+            task->stats.ntoo_few_pixels++;
             continue;
+        }
 
         // a cluster should contain only boundary points around the
         // tag. it cannot be bigger than the whole screen. (Reject
@@ -1231,18 +1296,15 @@ static void do_quad_task(void *p)
         // times (because it has 3 neighbors). The maximum perimeter
         // is 2w+2h.
         if (zarray_size(cluster) > 3*(2*w+2*h)) {
+            task->stats.ntoo_many_pixels++;
             continue;
         }
 
         struct quad quad;
         memset(&quad, 0, sizeof(struct quad));
 
-        if (fit_quad(td, task->im, cluster, &quad)) {
-            pthread_mutex_lock(&td->mutex);
-
+        if (fit_quad(td, task->im, cluster, &quad, &task->stats, &task->segment_stats))
             zarray_add(quads, &quad);
-            pthread_mutex_unlock(&td->mutex);
-        }
     }
 }
 
@@ -1845,9 +1907,11 @@ zarray_t *apriltag_quad_thresh(apriltag_detector_t *td, image_u8_t *im)
         tasks[ntasks].cidx1 = imin(sz, i + chunksize);
         tasks[ntasks].h = h;
         tasks[ntasks].w = w;
-        tasks[ntasks].quads = quads;
+        tasks[ntasks].quads = zarray_create(sizeof(struct quad));
         tasks[ntasks].clusters = clusters;
         tasks[ntasks].im = im;
+        memset(&tasks[ntasks].stats, 0, sizeof(struct apriltag_quad_stats));
+        memset(&tasks[ntasks].segment_stats, 0, sizeof(struct apriltag_segment_stats));
 
         workerpool_add_task(td->wp, do_quad_task, &tasks[ntasks]);
         ntasks++;
@@ -1855,6 +1919,33 @@ zarray_t *apriltag_quad_thresh(apriltag_detector_t *td, image_u8_t *im)
 
     workerpool_run(td->wp);
 
+    // collect the results in task order, so that the output does not
+    // depend on thread scheduling.
+    memset(&td->segment_stats, 0, sizeof(struct apriltag_segment_stats));
+    td->stats.nclusters = sz;
+
+    for (int i = 0; i < ntasks; i++) {
+        zarray_add_all(quads, tasks[i].quads);
+        zarray_destroy(tasks[i].quads);
+
+        struct apriltag_quad_stats *ts = &tasks[i].stats;
+        td->stats.ntoo_few_pixels += ts->ntoo_few_pixels;
+        td->stats.ntoo_many_pixels += ts->ntoo_many_pixels;
+        td->stats.nwrong_orientation += ts->nwrong_orientation;
+        td->stats.nsegment_failed += ts->nsegment_failed;
+        td->stats.nline_fit_mse += ts->nline_fit_mse;
+        td->stats.ndegenerate += ts->ndegenerate;
+        td->stats.narea += ts->narea;
+        td->stats.nangle += ts->nangle;
+
+        for (int mode = 0; mode < 2; mode++) {
+            td->segment_stats.nclusters[mode] += tasks[i].segment_stats.nclusters[mode];
+            td->segment_stats.nsegmented[mode] += tasks[i].segment_stats.nsegmented[mode];
+            td->segment_stats.naccepted[mode] += tasks[i].segment_stats.naccepted[mode];
+            td->segment_stats.utime[mode] += tasks[i].segment_stats.utime[mode];
+        }
+    }
+
 #ifdef _MSC_VER
     free(tasks);
 #endif
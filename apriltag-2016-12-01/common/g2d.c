@@ -330,7 +330,7 @@ int g2d_polygon_contains_point(const zarray_t *poly, double q[2])
     int psz = zarray_size(poly);
     assert(psz > 0);
 
-    int last_quadrant;
+    int last_quadrant = 0;
     int quad_acc = 0;
 
     for (int i = 0; i <= psz; i++) {
@@ -714,6 +714,88 @@ int g2d_polygon_rasterize(const zarray_t *poly, double y, double *x)
     return xpos;
 }
 
+int g2d_convex_is_convex(const double p[][2], int n)
+{
+    int npositive = 0, nnegative = 0;
+
+    for (int i = 0; i < n; i++) {
+        const double *a = p[i], *b = p[(i + 1) % n], *c = p[(i + 2) % n];
+        double cross = (b[0] - a[0])*(c[1] - b[1]) - (b[1] - a[1])*(c[0] - b[0]);
+        npositive += cross > 0;
+        nnegative += cross < 0;
+    }
+
+    return npositive == n || nnegative == n;
+}
+
+double g2d_convex_signed_area(const double p[][2], int n)
+{
+    // shoelace formula.
+    double acc = 0;
+    for (int i = 0, j = n - 1; i < n; j = i++)
+        acc += p[j][0]*p[i][1] - p[i][0]*p[j][1];
+
+    return acc / 2;
+}
+
+int g2d_convex_contains_point(const double p[][2], int n, const double q[2])
+{
+    // q is inside if it is on the inner side of every edge. Rather than
+    // branching per edge, track the extreme cross products, so that the
+    // winding does not need to be known.
+    double lo = HUGE_VAL, hi = -HUGE_VAL;
+
+    for (int i = 0, j = n - 1; i < n; j = i++) {
+        double cross = (p[i][0] - p[j][0])*(q[1] - p[j][1]) - (p[i][1] - p[j][1])*(q[0] - p[j][0]);
+        lo = cross < lo ? cross : lo;
+        hi = cross > hi ? cross : hi;
+    }
+
+    return lo >= 0 || hi <= 0;
+}
+
+int g2d_convex_contains_convex(const double pa[][2], int na, const double pb[][2], int nb)
+{
+    // a convex polygon contains every convex combination of points
+    // inside it.
+    for (int i = 0; i < nb; i++) {
+        if (!g2d_convex_contains_point(pa, na, pb[i]))
+            return 0;
+    }
+
+    return 1;
+}
+
+// Does an edge normal of pa separate pa and pb?
+static int g2d_convex_separates(const double pa[][2], int na, const double pb[][2], int nb)
+{
+    for (int i = 0, j = na - 1; i < na; j = i++) {
+        double nx = pa[j][1] - pa[i][1], ny = pa[i][0] - pa[j][0];
+
+        double mina = HUGE_VAL, maxa = -HUGE_VAL, minb = HUGE_VAL, maxb = -HUGE_VAL;
+        for (int k = 0; k < na; k++) {
+            double d = nx*pa[k][0] + ny*pa[k][1];
+            mina = d < mina ? d : mina;
+            maxa = d > maxa ? d : maxa;
+        }
+        for (int k = 0; k < nb; k++) {
+            double d = nx*pb[k][0] + ny*pb[k][1];
+            minb = d < minb ? d : minb;
+            maxb = d > maxb ? d : maxb;
+        }
+
+        if (maxa < minb || maxb < mina)
+            return 1;
+    }
+
+    return 0;
+}
+
+int g2d_convex_overlaps_convex(const double pa[][2], int na, const double pb[][2], int nb)
+{
+    return !g2d_convex_separates(pa, na, pb, nb) && !g2d_convex_separates(pb, nb, pa, na);
+}
+
 /*
   /---(1,5)
   (-2,4)-/        |
@@ -125,6 +125,31 @@ int g2d_polygon_overlaps_polygon(const zarray_t *polya, const zarray_t *polyb);
 // returns the number of points written to x. see comments.
 int g2d_polygon_rasterize(const zarray_t *poly, double y, double *x);
 
+////////////////////////////////////////////////////////////////////
+// Small convex polygons
+//
+// For hot loops, a convex polygon with a handful of vertices (a tag's
+// quad, say) can also be given as an array of points and a count, in
+// either winding. None of these allocate, and they are cheaper than
+// the zarray versions above, but the results are only meaningful for
+// convex polygons; see g2d_convex_is_convex().
+
+// Are all the turns of p in the same direction (and none straight)?
+int g2d_convex_is_convex(const double p[][2], int n);
+
+// The area of p: positive if CCW, negative if CW.
+double g2d_convex_signed_area(const double p[][2], int n);
+
+// Return 1 if q lies within p, or on its boundary.
+int g2d_convex_contains_point(const double p[][2], int n, const double q[2]);
+
+// Does pa completely contain pb? (Shared boundaries count.)
+int g2d_convex_contains_convex(const double pa[][2], int na, const double pb[][2], int nb);
+
+// Is there some point which is in both pa and pb? (Touching counts.)
+// A separating axis test on the edge normals of both polygons.
+int g2d_convex_overlaps_convex(const double pa[][2], int na, const double pb[][2], int nb);
+
 #ifdef __cplusplus
 }
 #endif
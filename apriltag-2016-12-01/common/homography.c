@@ -232,24 +232,81 @@ matd_t *homography_compute(zarray_t *correspondences, int flags)
 
     }
 
-    matd_t *Tx = matd_identity(3);
-    MATD_EL(Tx,0,2) = -x_cx;
-    MATD_EL(Tx,1,2) = -x_cy;
+    double Tx[9] = { 1, 0, -x_cx,
+                     0, 1, -x_cy,
+                     0, 0, 1 };
 
-    matd_t *Ty = matd_identity(3);
-    MATD_EL(Ty,0,2) = y_cx;
-    MATD_EL(Ty,1,2) = y_cy;
+    double Ty[9] = { 1, 0, y_cx,
+                     0, 1, y_cy,
+                     0, 0, 1 };
 
-    matd_t *H2 = matd_op("M*M*M", Ty, H, Tx);
+    double TyH[9];
+    matd33_multiply(Ty, H->data, TyH);
+
+    matd_t *H2 = matd_create(3, 3);
+    matd33_multiply(TyH, Tx, H2->data);
 
     matd_destroy(A);
-    matd_destroy(Tx);
-    matd_destroy(Ty);
     matd_destroy(H);
 
     return H2;
 }
 
+int homography33_inverse(const double *H, double *Hinv)
+{
+    return matd33_inverse(H, Hinv);
+}
+
+int homography33_square_to_quad(const double p[4][2], double *H)
+{
+    // First find M, which maps the unit square (0,0), (1,0), (1,1),
+    // (0,1) to p[0..3]:
+    //
+    //     [ a b c ]
+    // M = [ d e f ]
+    //     [ g h 1 ]
+    double dx1 = p[1][0] - p[2][0], dx2 = p[3][0] - p[2][0];
+    double dy1 = p[1][1] - p[2][1], dy2 = p[3][1] - p[2][1];
+    double sx = p[0][0] - p[1][0] + p[2][0] - p[3][0];
+    double sy = p[0][1] - p[1][1] + p[2][1] - p[3][1];
+
+    double den = dx1*dy2 - dx2*dy1;
+    if (den == 0)
+        return -1;
+
+    // g = h = 0 when the quad is a parallelogram (sx = sy = 0).
+    double g = (sx*dy2 - dx2*sy) / den;
+    double h = (dx1*sy - sx*dy1) / den;
+
+    double a = p[1][0] - p[0][0] + g*p[1][0];
+    double b = p[3][0] - p[0][0] + h*p[3][0];
+    double c = p[0][0];
+    double d = p[1][1] - p[0][1] + g*p[1][1];
+    double e = p[3][1] - p[0][1] + h*p[3][1];
+    double f = p[0][1];
+
+    // Then H = M*T, where T maps [-1,1] onto [0,1]:
+    //
+    //     [ .5  0 .5 ]
+    // T = [  0 .5 .5 ]
+    //     [  0  0  1 ]
+    H[0] = .5*a;
+    H[1] = .5*b;
+    H[2] = .5*(a + b) + c;
+    H[3] = .5*d;
+    H[4] = .5*e;
+    H[5] = .5*(d + e) + f;
+    H[6] = .5*g;
+    H[7] = .5*h;
+    H[8] = .5*(g + h) + 1;
+
+    // M is singular if three of the points are collinear.
+    double det = a*(e - f*h) - b*(d - f*g) + c*(d*h - e*g);
+    if (det == 0)
+        return -1;
+
+    return 0;
+}
 
 // assuming that the projection matrix is:
 // [ fx 0  cx 0 ]
@@ -323,30 +380,16 @@ matd_t *homography_to_pose(const matd_t *H, double fx, double fy, double cx, dou
         // "proper", but probably increases the reprojection error. An
         // iterative alignment step would be superior.
 
-        matd_t *R = matd_create_data(3, 3, (double[]) { R00, R01, R02,
-                                                       R10, R11, R12,
-                                                       R20, R21, R22 });
-
-        matd_svd_t svd = matd_svd(R);
-        matd_destroy(R);
+        double R[9] = { R00, R01, R02,
+                        R10, R11, R12,
+                        R20, R21, R22 };
+        double Q[9];
 
-        R = matd_op("M*M'", svd.U, svd.V);
-
-        matd_destroy(svd.U);
-        matd_destroy(svd.S);
-        matd_destroy(svd.V);
-
-        R00 = MATD_EL(R, 0, 0);
-        R01 = MATD_EL(R, 0, 1);
-        R02 = MATD_EL(R, 0, 2);
-        R10 = MATD_EL(R, 1, 0);
-        R11 = MATD_EL(R, 1, 1);
-        R12 = MATD_EL(R, 1, 2);
-        R20 = MATD_EL(R, 2, 0);
-        R21 = MATD_EL(R, 2, 1);
-        R22 = MATD_EL(R, 2, 2);
-
-        matd_destroy(R);
+        if (matd33_polar(R, Q) == 0) {
+            R00 = Q[0]; R01 = Q[1]; R02 = Q[2];
+            R10 = Q[3]; R11 = Q[4]; R12 = Q[5];
+            R20 = Q[6]; R21 = Q[7]; R22 = Q[8];
+        }
     }
 
     return matd_create_data(4, 4, (double[]) { R00, R01, R02, TX,
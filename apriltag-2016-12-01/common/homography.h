@@ -147,6 +147,43 @@ static inline void homography_project(const matd_t *H, double x, double y, doubl
     *oy = yy / zz;
 }
 
+// The homography33_* functions operate on 3x3 homographies stored
+// inline as a row-major double[9], and never allocate.
+
+static inline void homography33_project(const double *H, double x, double y, double *ox, double *oy)
+{
+    double xx = H[0]*x + H[1]*y + H[2];
+    double yy = H[3]*x + H[4]*y + H[5];
+    double zz = H[6]*x + H[7]*y + H[8];
+
+    *ox = xx / zz;
+    *oy = yy / zz;
+}
+
+// Computes Hinv = inverse(H). Returns non-zero if H is singular. H
+// and Hinv may not alias.
+int homography33_inverse(const double *H, double *Hinv);
+
+// Computes the homography H that maps the square with corners (-1,-1),
+// (1,-1), (1,1), (-1,1) onto the four given points (in that order),
+// using the closed-form projective mapping of the unit square
+// (Heckbert, 1989). This is exact for four correspondences, and much
+// cheaper than homography_compute(). Returns non-zero if the points
+// are degenerate (e.g., three are collinear).
+int homography33_square_to_quad(const double p[4][2], double *H);
+
+// Copies a 3x3 matd_t into a double[9] and back.
+static inline void homography33_from_matd(const matd_t *M, double *H)
+{
+    for (int i = 0; i < 9; i++)
+        H[i] = M->data[i];
+}
+
+static inline matd_t *homography33_to_matd(const double *H)
+{
+    return matd_create_data(3, 3, H);
+}
+
 // assuming that the projection matrix is:
 // [ fx 0  cx 0 ]
 // [  0 fy cy 0 ]
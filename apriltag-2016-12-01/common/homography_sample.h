@@ -0,0 +1,252 @@
+/* Copyright (C) 2013-2016, The Regents of The University of Michigan.
+All rights reserved.
+
+This software was developed in the APRIL Robotics Lab under the
+direction of Edwin Olson, ebolson@umich.edu. This software may be
+available under alternative licensing terms; contact the address above.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those
+of the authors and should not be interpreted as representing official policies,
+either expressed or implied, of the Regents of The University of Michigan.
+*/
+
+// Grid sampling kernels for the decoder. These are kept out of
+// homography.h, and so out of anything apriltag.h includes, because
+// they pull in math_util.h (whose min/max macros break C++ callers)
+// and the SSE2 intrinsics.
+
+#ifndef _HOMOGRAPHY_SAMPLE_H
+#define _HOMOGRAPHY_SAMPLE_H
+
+#include <math.h>
+#include <stdint.h>
+
+#include "image_u8.h"
+#include "math_util.h"
+
+// SSE2 is baseline on x86-64, but MSVC never defines __SSE2__; it
+// signals it with _M_X64, or _M_IX86_FP >= 2 for 32-bit /arch:SSE2.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define HOMOGRAPHY_HAVE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Interpolation modes for homography33_sample_grid().
+#define HOMOGRAPHY_SAMPLE_NEAREST 0
+#define HOMOGRAPHY_SAMPLE_BILINEAR 1
+
+// One sample of homography33_sample_grid().
+static inline float homography33_sample_u8(const image_u8_t *im, int interpolation, double px, double py)
+{
+    // don't round
+    int ix = px;
+    int iy = py;
+    if (ix < 0 || iy < 0 || ix >= im->width || iy >= im->height)
+        return -1;
+
+    if (interpolation == HOMOGRAPHY_SAMPLE_NEAREST)
+        return im->buf[iy*im->stride + ix];
+
+    // pixel centers are at half-integer coordinates.
+    double fx = px - .5, fy = py - .5;
+    int x0 = floor(fx), y0 = floor(fy);
+    float ax = fx - x0, ay = fy - y0;
+
+    // (ix, iy) is inside, but a neighbor of (px, py) can be two
+    // pixels away from it when px or py is in (-1, 0).
+    int xa = iclamp(x0, 0, im->width - 1), xb = iclamp(x0 + 1, 0, im->width - 1);
+    int ya = iclamp(y0, 0, im->height - 1), yb = iclamp(y0 + 1, 0, im->height - 1);
+
+    const uint8_t *ra = &im->buf[ya*im->stride], *rb = &im->buf[yb*im->stride];
+
+    float top = ra[xa] + ax*(ra[xb] - ra[xa]);
+    float bottom = rb[xa] + ax*(rb[xb] - rb[xa]);
+
+    return top + ay*(bottom - top);
+}
+
+#ifdef HOMOGRAPHY_HAVE_SSE2
+// Clamps each 32-bit lane of v to [lo, hi]; SSE2 only has integer
+// min and max for 16-bit lanes.
+static inline __m128i homography33_clamp_epi32(__m128i v, int lo, int hi)
+{
+    __m128i vlo = _mm_set1_epi32(lo), vhi = _mm_set1_epi32(hi);
+
+    __m128i m = _mm_cmplt_epi32(v, vlo);
+    v = _mm_or_si128(_mm_and_si128(m, vlo), _mm_andnot_si128(m, v));
+    m = _mm_cmpgt_epi32(v, vhi);
+    return _mm_or_si128(_mm_and_si128(m, vhi), _mm_andnot_si128(m, v));
+}
+
+// floor() of two doubles, which must fit in an int to be meaningful.
+static inline __m128d homography33_floor_pd(__m128d v)
+{
+    __m128d t = _mm_cvtepi32_pd(_mm_cvttpd_epi32(v));
+    return _mm_sub_pd(t, _mm_and_pd(_mm_cmpgt_pd(t, v), _mm_set1_pd(1)));
+}
+
+// Four BILINEAR samples of homography33_sample_grid(), at
+// (px01[0], py01[0]), (px01[1], py01[1]), (px23[0], py23[0]) and
+// (px23[1], py23[1]). The bounds tests, bilinear weights and
+// interpolation run one sample per lane; only the pixel reads are
+// scalar, as SSE2 has no gather. The results are identical to
+// homography33_sample_u8()'s.
+static inline void homography33_sample4_bilinear_u8(const image_u8_t *im,
+                                                    __m128d px01, __m128d px23, __m128d py01, __m128d py23,
+                                                    float *out)
+{
+    // don't round
+    __m128i ix = _mm_unpacklo_epi64(_mm_cvttpd_epi32(px01), _mm_cvttpd_epi32(px23));
+    __m128i iy = _mm_unpacklo_epi64(_mm_cvttpd_epi32(py01), _mm_cvttpd_epi32(py23));
+
+    // out-of-range and NaN coordinates convert to INT_MIN, which is
+    // outside too.
+    __m128i minus1 = _mm_set1_epi32(-1);
+    __m128i inside = _mm_and_si128(_mm_and_si128(_mm_cmpgt_epi32(ix, minus1),
+                                                 _mm_cmplt_epi32(ix, _mm_set1_epi32(im->width))),
+                                   _mm_and_si128(_mm_cmpgt_epi32(iy, minus1),
+                                                 _mm_cmplt_epi32(iy, _mm_set1_epi32(im->height))));
+
+    // pixel centers are at half-integer coordinates.
+    __m128d half = _mm_set1_pd(.5);
+    __m128d fx01 = _mm_sub_pd(px01, half), fx23 = _mm_sub_pd(px23, half);
+    __m128d fy01 = _mm_sub_pd(py01, half), fy23 = _mm_sub_pd(py23, half);
+    __m128d x001 = homography33_floor_pd(fx01), x023 = homography33_floor_pd(fx23);
+    __m128d y001 = homography33_floor_pd(fy01), y023 = homography33_floor_pd(fy23);
+
+    __m128 ax = _mm_movelh_ps(_mm_cvtpd_ps(_mm_sub_pd(fx01, x001)), _mm_cvtpd_ps(_mm_sub_pd(fx23, x023)));
+    __m128 ay = _mm_movelh_ps(_mm_cvtpd_ps(_mm_sub_pd(fy01, y001)), _mm_cvtpd_ps(_mm_sub_pd(fy23, y023)));
+
+    // clamping also keeps the reads of outside lanes in the image.
+    __m128i one = _mm_set1_epi32(1);
+    __m128i x0 = _mm_unpacklo_epi64(_mm_cvttpd_epi32(x001), _mm_cvttpd_epi32(x023));
+    __m128i y0 = _mm_unpacklo_epi64(_mm_cvttpd_epi32(y001), _mm_cvttpd_epi32(y023));
+
+    int32_t xa[4], xb[4], ya[4], yb[4];
+    _mm_storeu_si128((__m128i*) xa, homography33_clamp_epi32(x0, 0, im->width - 1));
+    _mm_storeu_si128((__m128i*) xb, homography33_clamp_epi32(_mm_add_epi32(x0, one), 0, im->width - 1));
+    _mm_storeu_si128((__m128i*) ya, homography33_clamp_epi32(y0, 0, im->height - 1));
+    _mm_storeu_si128((__m128i*) yb, homography33_clamp_epi32(_mm_add_epi32(y0, one), 0, im->height - 1));
+
+    float p00[4], p01[4], p10[4], p11[4];
+    for (int k = 0; k < 4; k++) {
+        const uint8_t *ra = &im->buf[ya[k]*im->stride], *rb = &im->buf[yb[k]*im->stride];
+        p00[k] = ra[xa[k]];
+        p01[k] = ra[xb[k]];
+        p10[k] = rb[xa[k]];
+        p11[k] = rb[xb[k]];
+    }
+
+    __m128 v00 = _mm_loadu_ps(p00), v01 = _mm_loadu_ps(p01);
+    __m128 v10 = _mm_loadu_ps(p10), v11 = _mm_loadu_ps(p11);
+
+    __m128 top = _mm_add_ps(v00, _mm_mul_ps(ax, _mm_sub_ps(v01, v00)));
+    __m128 bottom = _mm_add_ps(v10, _mm_mul_ps(ax, _mm_sub_ps(v11, v10)));
+    __m128 v = _mm_add_ps(top, _mm_mul_ps(ay, _mm_sub_ps(bottom, top)));
+
+    __m128 m = _mm_castsi128_ps(inside);
+    _mm_storeu_ps(out, _mm_or_ps(_mm_and_ps(m, v), _mm_andnot_ps(m, _mm_set1_ps(-1))));
+}
+#endif
+
+// Samples im at the projections through H of the nrows x ncols grid
+// of points (x0 + i*ux + j*vx, y0 + i*uy + j*vy), i being the column
+// and j the row, and writes them row-major to values. The homogeneous
+// coordinates are stepped along each row rather than recomputed for
+// every point. Where SSE2 is available, BILINEAR rows are done four
+// points at a time with homography33_sample4_bilinear_u8(); NEAREST,
+// which is little more than the divide and a read, stays scalar, as
+// SIMD did not make it faster.
+//
+// A projection (px, py) falls into pixel ((int) px, (int) py); if
+// that pixel is outside im, the sample is -1. Otherwise NEAREST
+// returns that pixel and BILINEAR interpolates between the four
+// pixel centers around (px, py), clamped to the image.
+//
+// Inline, so that callers with a fixed grid get the loops unrolled.
+static inline void homography33_sample_grid(const double *H, const image_u8_t *im, int interpolation,
+                                            double x0, double y0, double ux, double uy, double vx, double vy,
+                                            int ncols, int nrows, float *values)
+{
+    // moving one column to the right changes the pre-normalized
+    // coordinates by a constant.
+    double dX = H[0]*ux + H[1]*uy;
+    double dY = H[3]*ux + H[4]*uy;
+    double dZ = H[6]*ux + H[7]*uy;
+
+    for (int j = 0; j < nrows; j++) {
+        double rx = x0 + j*vx, ry = y0 + j*vy;
+
+        double X = H[0]*rx + H[1]*ry + H[2];
+        double Y = H[3]*rx + H[4]*ry + H[5];
+        double Z = H[6]*rx + H[7]*ry + H[8];
+
+        float *out = &values[j*ncols];
+        int i = 0;
+
+#ifdef HOMOGRAPHY_HAVE_SSE2
+        if (interpolation == HOMOGRAPHY_SAMPLE_BILINEAR) {
+            __m128d vX01 = _mm_set_pd(X + dX, X), vX23 = _mm_set_pd(X + 3*dX, X + 2*dX);
+            __m128d vY01 = _mm_set_pd(Y + dY, Y), vY23 = _mm_set_pd(Y + 3*dY, Y + 2*dY);
+            __m128d vZ01 = _mm_set_pd(Z + dZ, Z), vZ23 = _mm_set_pd(Z + 3*dZ, Z + 2*dZ);
+            __m128d vdX = _mm_set1_pd(4*dX), vdY = _mm_set1_pd(4*dY), vdZ = _mm_set1_pd(4*dZ);
+
+            for (; i + 3 < ncols; i += 4) {
+                homography33_sample4_bilinear_u8(im,
+                                                 _mm_div_pd(vX01, vZ01), _mm_div_pd(vX23, vZ23),
+                                                 _mm_div_pd(vY01, vZ01), _mm_div_pd(vY23, vZ23),
+                                                 &out[i]);
+
+                vX01 = _mm_add_pd(vX01, vdX);
+                vX23 = _mm_add_pd(vX23, vdX);
+                vY01 = _mm_add_pd(vY01, vdY);
+                vY23 = _mm_add_pd(vY23, vdY);
+                vZ01 = _mm_add_pd(vZ01, vdZ);
+                vZ23 = _mm_add_pd(vZ23, vdZ);
+            }
+
+            X += i*dX;
+            Y += i*dY;
+            Z += i*dZ;
+        }
+#endif
+
+        for (; i < ncols; i++) {
+            out[i] = homography33_sample_u8(im, interpolation, X / Z, Y / Z);
+
+            X += dX;
+            Y += dY;
+            Z += dZ;
+        }
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
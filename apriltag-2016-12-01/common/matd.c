@@ -2065,3 +2065,144 @@ double matd_max(matd_t *m)
 
     return d;
 }
+
+int matd_sym_solve(double *A, double *b, int n)
+{
+    for (int j = 0; j < n; j++) {
+        double d = A[j*n + j];
+        for (int k = 0; k < j; k++)
+            d -= A[j*n + k] * A[j*n + k];
+        if (d <= 0)
+            return -1;
+        d = sqrt(d);
+        A[j*n + j] = d;
+
+        for (int i = j + 1; i < n; i++) {
+            double v = A[i*n + j];
+            for (int k = 0; k < j; k++)
+                v -= A[i*n + k] * A[j*n + k];
+            A[i*n + j] = v / d;
+        }
+    }
+
+    // L y = b, then L' x = y
+    for (int i = 0; i < n; i++) {
+        for (int k = 0; k < i; k++)
+            b[i] -= A[i*n + k] * b[k];
+        b[i] /= A[i*n + i];
+    }
+    for (int i = n - 1; i >= 0; i--) {
+        for (int k = i + 1; k < n; k++)
+            b[i] -= A[k*n + i] * b[k];
+        b[i] /= A[i*n + i];
+    }
+
+    return 0;
+}
+
+int matd33_inverse(const double *A, double *Ainv)
+{
+    // cofactors of the first row
+    double c00 = A[4]*A[8] - A[5]*A[7];
+    double c01 = A[5]*A[6] - A[3]*A[8];
+    double c02 = A[3]*A[7] - A[4]*A[6];
+
+    double det = A[0]*c00 + A[1]*c01 + A[2]*c02;
+    if (det == 0)
+        return -1;
+
+    double invdet = 1.0 / det;
+
+    Ainv[0] = c00 * invdet;
+    Ainv[1] = (A[2]*A[7] - A[1]*A[8]) * invdet;
+    Ainv[2] = (A[1]*A[5] - A[2]*A[4]) * invdet;
+    Ainv[3] = c01 * invdet;
+    Ainv[4] = (A[0]*A[8] - A[2]*A[6]) * invdet;
+    Ainv[5] = (A[2]*A[3] - A[0]*A[5]) * invdet;
+    Ainv[6] = c02 * invdet;
+    Ainv[7] = (A[1]*A[6] - A[0]*A[7]) * invdet;
+    Ainv[8] = (A[0]*A[4] - A[1]*A[3]) * invdet;
+
+    return 0;
+}
+
+int matd33_polar(const double *A, double *Q)
+{
+    double X[9], Xinv[9];
+    memcpy(X, A, sizeof(X));
+
+    // Higham's determinant scaling makes the first iterations
+    // contract quickly even when the singular values of A are far
+    // from 1; convergence is then quadratic.
+    for (int iter = 0; iter < 32; iter++) {
+        double det = matd33_det(X);
+        if (det == 0 || matd33_inverse(X, Xinv))
+            return -1;
+
+        double z = pow(fabs(det), -1.0 / 3);
+
+        double delta = 0;
+        for (int i = 0; i < 3; i++) {
+            for (int j = 0; j < 3; j++) {
+                double v = 0.5 * (z*X[3*i + j] + Xinv[3*j + i] / z);
+                delta += (v - X[3*i + j]) * (v - X[3*i + j]);
+                Q[3*i + j] = v;
+            }
+        }
+
+        memcpy(X, Q, sizeof(X));
+
+        // ||Q||^2 = 3
+        if (delta < 1e-24)
+            break;
+    }
+
+    return 0;
+}
+
+int matd44_inverse(const double *A, double *Ainv)
+{
+    // 2x2 minors of the top two rows (s) and of the bottom two rows
+    // (c), from which every cofactor of A follows.
+    double s0 = A[0]*A[5] - A[4]*A[1];
+    double s1 = A[0]*A[6] - A[4]*A[2];
+    double s2 = A[0]*A[7] - A[4]*A[3];
+    double s3 = A[1]*A[6] - A[5]*A[2];
+    double s4 = A[1]*A[7] - A[5]*A[3];
+    double s5 = A[2]*A[7] - A[6]*A[3];
+
+    double c5 = A[10]*A[15] - A[14]*A[11];
+    double c4 = A[9]*A[15] - A[13]*A[11];
+    double c3 = A[9]*A[14] - A[13]*A[10];
+    double c2 = A[8]*A[15] - A[12]*A[11];
+    double c1 = A[8]*A[14] - A[12]*A[10];
+    double c0 = A[8]*A[13] - A[12]*A[9];
+
+    double det = s0*c5 - s1*c4 + s2*c3 + s3*c2 - s4*c1 + s5*c0;
+    if (det == 0)
+        return -1;
+
+    double invdet = 1.0 / det;
+
+    Ainv[0] = ( A[5]*c5 - A[6]*c4 + A[7]*c3) * invdet;
+    Ainv[1] = (-A[1]*c5 + A[2]*c4 - A[3]*c3) * invdet;
+    Ainv[2] = ( A[13]*s5 - A[14]*s4 + A[15]*s3) * invdet;
+    Ainv[3] = (-A[9]*s5 + A[10]*s4 - A[11]*s3) * invdet;
+
+    Ainv[4] = (-A[4]*c5 + A[6]*c2 - A[7]*c1) * invdet;
+    Ainv[5] = ( A[0]*c5 - A[2]*c2 + A[3]*c1) * invdet;
+    Ainv[6] = (-A[12]*s5 + A[14]*s2 - A[15]*s1) * invdet;
+    Ainv[7] = ( A[8]*s5 - A[10]*s2 + A[11]*s1) * invdet;
+
+    Ainv[8] = ( A[4]*c4 - A[5]*c2 + A[7]*c0) * invdet;
+    Ainv[9] = (-A[0]*c4 + A[1]*c2 - A[3]*c0) * invdet;
+    Ainv[10] = ( A[12]*s4 - A[13]*s2 + A[15]*s0) * invdet;
+    Ainv[11] = (-A[8]*s4 + A[9]*s2 - A[11]*s0) * invdet;
+
+    Ainv[12] = (-A[4]*c3 + A[5]*c1 - A[6]*c0) * invdet;
+    Ainv[13] = ( A[0]*c3 - A[1]*c1 + A[2]*c0) * invdet;
+    Ainv[14] = (-A[12]*s3 + A[13]*s1 - A[14]*s0) * invdet;
+    Ainv[15] = ( A[8]*s3 - A[9]*s1 + A[10]*s0) * invdet;
+
+    return 0;
+}
@@ -447,6 +447,83 @@ void matd_utriangle_solve(matd_t *u, const double *b, double *x);
 
 double matd_max(matd_t *m);
 
+////////////////////////////////
+// Fixed-size kernels
+
+// The matd33_* and matd44_* functions operate on 3x3 and 4x4
+// matrices stored inline as row-major double[9] and double[16]. They
+// never allocate, and cost a small fraction of the equivalent
+// matd_op() expression, which parses its expression and allocates
+// every intermediate on each call. Outputs may not alias inputs.
+
+// C = A*B
+static inline void matd33_multiply(const double *A, const double *B, double *C)
+{
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++)
+            C[3*i + j] = A[3*i + 0]*B[j] + A[3*i + 1]*B[3 + j] + A[3*i + 2]*B[6 + j];
+}
+
+// C = A*B'
+static inline void matd33_multiply_transpose(const double *A, const double *B, double *C)
+{
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++)
+            C[3*i + j] = A[3*i + 0]*B[3*j + 0] + A[3*i + 1]*B[3*j + 1] + A[3*i + 2]*B[3*j + 2];
+}
+
+// C = A'
+static inline void matd33_transpose(const double *A, double *C)
+{
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++)
+            C[3*i + j] = A[3*j + i];
+}
+
+static inline double matd33_det(const double *A)
+{
+    return A[0]*(A[4]*A[8] - A[5]*A[7]) +
+        A[1]*(A[5]*A[6] - A[3]*A[8]) +
+        A[2]*(A[3]*A[7] - A[4]*A[6]);
+}
+
+// Ainv = A^-1, by cofactors. Returns non-zero if A is singular.
+int matd33_inverse(const double *A, double *Ainv);
+
+// Computes the orthogonal factor Q of the polar decomposition A = QP,
+// i.e., U*V' where A = U*S*V', which is the orthogonal matrix closest
+// to A. (It is a rotation when det(A) > 0.) Uses the scaled Newton
+// iteration Q <- (zQ + (zQ)^-T) / 2, which converges in a handful of
+// iterations. Returns non-zero if A is singular.
+int matd33_polar(const double *A, double *Q);
+
+// C = A*B
+static inline void matd44_multiply(const double *A, const double *B, double *C)
+{
+    for (int i = 0; i < 4; i++)
+        for (int j = 0; j < 4; j++)
+            C[4*i + j] = A[4*i + 0]*B[j] + A[4*i + 1]*B[4 + j] +
+                A[4*i + 2]*B[8 + j] + A[4*i + 3]*B[12 + j];
+}
+
+// C = A'
+static inline void matd44_transpose(const double *A, double *C)
+{
+    for (int i = 0; i < 4; i++)
+        for (int j = 0; j < 4; j++)
+            C[4*i + j] = A[4*j + i];
+}
+
+// Ainv = A^-1, by cofactors. Returns non-zero if A is singular.
+int matd44_inverse(const double *A, double *Ainv);
+
+// Solves A x = b in place (x is returned in b) for a symmetric
+// positive definite n x n matrix A, by Cholesky decomposition; A is
+// overwritten. Unlike matd_chol_solve(), allocates nothing, which
+// suits the small normal equations of iterative solvers. Returns
+// non-zero if A is not positive definite.
+int matd_sym_solve(double *A, double *b, int n);
+
 #ifdef __cplusplus
 }
 #endif
@@ -196,6 +196,19 @@ static inline double dclamp(double a, double min, double max)
     return a;
 }
 
+// number of set bits in v.
+static inline int popcount64(uint64_t v)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(v);
+#else
+    v = v - ((v >> 1) & 0x5555555555555555ULL);
+    v = (v & 0x3333333333333333ULL) + ((v >> 2) & 0x3333333333333333ULL);
+    v = (v + (v >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+    return (int) ((v * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
 static inline int fltcmp (float f1, float f2)
 {
     float epsilon = f1-f2;
@@ -468,21 +468,24 @@ static inline int zarray_index_of(const zarray_t *za, const void *p)
 /**
  * Add all elements from 'source' into 'dest'. el_size must be the same
  * for both lists
+ *
+ * This is a single bulk copy, which makes it the natural way to merge
+ * per-task output arrays (in task order) after a workerpool_run(),
+ * rather than having every task lock and zarray_add() into a shared
+ * array.
  **/
 static inline void zarray_add_all(zarray_t * dest, const zarray_t * source)
 {
+    assert(dest != NULL);
+    assert(source != NULL);
     assert(dest->el_sz == source->el_sz);
 
-    // Don't allocate on stack because el_sz could be larger than ~8 MB
-    // stack size
-    char *tmp = (char*)calloc(1, dest->el_sz);
-
-    for (int i = 0; i < zarray_size(source); i++) {
-        zarray_get(source, i, tmp);
-        zarray_add(dest, tmp);
-   }
+    if (source->size == 0)
+        return;
 
-    free(tmp);
+    zarray_ensure_capacity(dest, dest->size + source->size);
+    memcpy(&dest->data[dest->size*dest->el_sz], source->data, source->size*source->el_sz);
+    dest->size += source->size;
 }
 
 #ifdef __cplusplus
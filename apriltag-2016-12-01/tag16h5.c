@@ -36,51 +36,39 @@ either expressed or implied, of the Regents of The University of Michigan.
 #include <stdlib.h>
 #include "apriltag.h"
 
+static const uint64_t codedata[30] = {
+   0x000000000000231bUL, 0x0000000000002ea5UL, 0x000000000000346aUL, 0x00000000000045b9UL,
+   0x00000000000079a6UL, 0x0000000000007f6bUL, 0x000000000000b358UL, 0x000000000000e745UL,
+   0x000000000000fe59UL, 0x000000000000156dUL, 0x000000000000380bUL, 0x000000000000f0abUL,
+   0x0000000000000d84UL, 0x0000000000004736UL, 0x0000000000008c72UL, 0x000000000000af10UL,
+   0x000000000000093cUL, 0x00000000000093b4UL, 0x000000000000a503UL, 0x000000000000468fUL,
+   0x000000000000e137UL, 0x0000000000005795UL, 0x000000000000df42UL, 0x0000000000001c1dUL,
+   0x000000000000e9dcUL, 0x00000000000073adUL, 0x000000000000ad5fUL, 0x000000000000d530UL,
+   0x00000000000007caUL, 0x000000000000af2eUL,
+};
+
+static const apriltag_family_t family = {
+   .ncodes = 30,
+   .codes = codedata,
+   .black_border = 1,
+   .d = 4,
+   .h = 5,
+   .name = "tag16h5",
+};
+
+const apriltag_family_t *tag16h5_family()
+{
+   return &family;
+}
+
 apriltag_family_t *tag16h5_create()
 {
-   apriltag_family_t *tf = calloc(1, sizeof(apriltag_family_t));
-   tf->name = strdup("tag16h5");
-   tf->black_border = 1;
-   tf->d = 4;
-   tf->h = 5;
-   tf->ncodes = 30;
-   tf->codes = calloc(30, sizeof(uint64_t));
-   tf->codes[0] = 0x000000000000231bUL;
-   tf->codes[1] = 0x0000000000002ea5UL;
-   tf->codes[2] = 0x000000000000346aUL;
-   tf->codes[3] = 0x00000000000045b9UL;
-   tf->codes[4] = 0x00000000000079a6UL;
-   tf->codes[5] = 0x0000000000007f6bUL;
-   tf->codes[6] = 0x000000000000b358UL;
-   tf->codes[7] = 0x000000000000e745UL;
-   tf->codes[8] = 0x000000000000fe59UL;
-   tf->codes[9] = 0x000000000000156dUL;
-   tf->codes[10] = 0x000000000000380bUL;
-   tf->codes[11] = 0x000000000000f0abUL;
-   tf->codes[12] = 0x0000000000000d84UL;
-   tf->codes[13] = 0x0000000000004736UL;
-   tf->codes[14] = 0x0000000000008c72UL;
-   tf->codes[15] = 0x000000000000af10UL;
-   tf->codes[16] = 0x000000000000093cUL;
-   tf->codes[17] = 0x00000000000093b4UL;
-   tf->codes[18] = 0x000000000000a503UL;
-   tf->codes[19] = 0x000000000000468fUL;
-   tf->codes[20] = 0x000000000000e137UL;
-   tf->codes[21] = 0x0000000000005795UL;
-   tf->codes[22] = 0x000000000000df42UL;
-   tf->codes[23] = 0x0000000000001c1dUL;
-   tf->codes[24] = 0x000000000000e9dcUL;
-   tf->codes[25] = 0x00000000000073adUL;
-   tf->codes[26] = 0x000000000000ad5fUL;
-   tf->codes[27] = 0x000000000000d530UL;
-   tf->codes[28] = 0x00000000000007caUL;
-   tf->codes[29] = 0x000000000000af2eUL;
+   apriltag_family_t *tf = malloc(sizeof(apriltag_family_t));
+   *tf = family;
    return tf;
 }
 
 void tag16h5_destroy(apriltag_family_t *tf)
 {
-   free(tf->name);
-   free(tf->codes);
    free(tf);
 }
@@ -40,6 +40,13 @@ either expressed or implied, of the Regents of The University of Michigan.
 extern "C" {
 #endif
 
+// The family's descriptor and codes are constant data, shared by all
+// callers; they must not be modified or freed.
+const apriltag_family_t *tag25h9_family();
+
+// Returns a copy of the descriptor that the caller may modify (e.g.,
+// its black_border), to be freed with tag25h9_destroy(). The codes
+// are still shared.
 apriltag_family_t *tag25h9_create();
 void tag25h9_destroy(apriltag_family_t *tf);
 
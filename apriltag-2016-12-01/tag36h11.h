@@ -40,6 +40,13 @@ either expressed or implied, of the Regents of The University of Michigan.
 extern "C" {
 #endif
 
+// The family's descriptor and codes are constant data, shared by all
+// callers; they must not be modified or freed.
+const apriltag_family_t *tag36h11_family();
+
+// Returns a copy of the descriptor that the caller may modify (e.g.,
+// its black_border), to be freed with tag36h11_destroy(). The codes
+// are still shared.
 apriltag_family_t *tag36h11_create();
 void tag36h11_destroy(apriltag_family_t *tf);
 
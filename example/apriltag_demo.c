@@ -70,6 +70,13 @@ int main(int argc, char *argv[])
     getopt_add_bool(getopt, '0', "refine-edges", 1, "Spend more time trying to align edges of tags");
     getopt_add_bool(getopt, '1', "refine-decode", 0, "Spend more time trying to decode tags");
     getopt_add_bool(getopt, '2', "refine-pose", 0, "Spend more time trying to precisely localize tags");
+    getopt_add_string(getopt, '\0', "refine-pose-mode", "hill-climb", "How refine-pose refines corners: hill-climb or gauss-newton");
+    getopt_add_string(getopt, '\0', "segment", "maxima", "Corner segmentation strategy: maxima, agg or auto");
+    getopt_add_bool(getopt, '\0', "bilinear", 0, "Interpolate when sampling the bits of a tag");
+    getopt_add_bool(getopt, '\0', "decode-first", 0, "Decode quads before refining, and refine only tags and near misses");
+    getopt_add_bool(getopt, '\0', "early-reject", 0, "Reject quads early by sampling their border first");
+    getopt_add_double(getopt, '\0', "min-margin", "0", "Reject quads with a smaller decision margin");
+    getopt_add_string(getopt, '\0', "decode-index", "", "Load the decode index from this file, creating it if needed");
 
     if (!getopt_parse(getopt, argc, argv, 1) || getopt_get_bool(getopt, "help")) {
         printf("Usage: %s [options] <input files>\n", argv[0]);
@@ -98,8 +105,19 @@ int main(int argc, char *argv[])
 
     tf->black_border = getopt_get_int(getopt, "border");
 
+    const char *index_path = getopt_get_string(getopt, "decode-index");
+    apriltag_decode_index_t *index = NULL;
+    if (strlen(index_path))
+        index = apriltag_decode_index_load(tf, index_path);
+
+    if (index == NULL) {
+        index = apriltag_decode_index_create(tf, 2, APRILTAG_DECODER_AUTO);
+        if (strlen(index_path) && apriltag_decode_index_save(index, index_path))
+            printf("Unable to write decode index to %s\n", index_path);
+    }
+
     apriltag_detector_t *td = apriltag_detector_create();
-    apriltag_detector_add_family(td, tf);
+    apriltag_detector_add_family_index(td, index);
     td->quad_decimate = getopt_get_double(getopt, "decimate");
     td->quad_sigma = getopt_get_double(getopt, "blur");
     td->nthreads = getopt_get_int(getopt, "threads");
@@ -107,9 +125,43 @@ int main(int argc, char *argv[])
     td->refine_edges = getopt_get_bool(getopt, "refine-edges");
     td->refine_decode = getopt_get_bool(getopt, "refine-decode");
     td->refine_pose = getopt_get_bool(getopt, "refine-pose");
+    td->decode_sampling = getopt_get_bool(getopt, "bilinear") ? APRILTAG_DECODE_SAMPLING_BILINEAR : APRILTAG_DECODE_SAMPLING_NEAREST;
+    td->decode_early_reject = getopt_get_bool(getopt, "early-reject");
+    td->decode_first = getopt_get_bool(getopt, "decode-first");
+    td->min_decision_margin = getopt_get_double(getopt, "min-margin");
+
+    const char *segment = getopt_get_string(getopt, "segment");
+    if (!strcmp(segment, "maxima"))
+        td->qtp.segment_mode = APRILTAG_SEGMENT_MAXIMA;
+    else if (!strcmp(segment, "agg"))
+        td->qtp.segment_mode = APRILTAG_SEGMENT_AGG;
+    else if (!strcmp(segment, "auto"))
+        td->qtp.segment_mode = APRILTAG_SEGMENT_AUTO;
+    else {
+        printf("Unrecognized segmentation strategy. Use maxima, agg or auto.\n");
+        exit(-1);
+    }
+
+    const char *refine_pose_mode = getopt_get_string(getopt, "refine-pose-mode");
+    if (!strcmp(refine_pose_mode, "hill-climb"))
+        td->refine_pose_mode = APRILTAG_REFINE_POSE_HILL_CLIMB;
+    else if (!strcmp(refine_pose_mode, "gauss-newton"))
+        td->refine_pose_mode = APRILTAG_REFINE_POSE_GAUSS_NEWTON;
+    else {
+        printf("Unrecognized refine-pose mode. Use hill-climb or gauss-newton.\n");
+        exit(-1);
+    }
 
     int quiet = getopt_get_bool(getopt, "quiet");
 
+    if (!quiet) {
+        struct apriltag_decode_index_info info;
+        apriltag_decode_index_get_info(index, &info);
+        printf("decode index: %u / %u slots, %.1f kB, probe length avg %.3f max %d\n",
+               info.nentries, info.capacity, info.nbytes / 1024.0,
+               info.avg_probe_length, info.max_probe_length);
+    }
+
     int maxiters = getopt_get_int(getopt, "iters");
 
     const int hamm_hist_max = 10;
@@ -205,6 +257,30 @@ int main(int argc, char *argv[])
 
             if (!quiet) {
                 timeprofile_display(td->tp);
+
+                struct apriltag_quad_stats *qs = &td->stats;
+                printf("clusters %u: too few pixels %u, too many pixels %u, wrong orientation %u, "
+                       "segmentation %u, line fit %u, degenerate %u, area %u, angle %u\n",
+                       qs->nclusters, qs->ntoo_few_pixels, qs->ntoo_many_pixels, qs->nwrong_orientation,
+                       qs->nsegment_failed, qs->nline_fit_mse, qs->ndegenerate, qs->narea, qs->nangle);
+                printf("quads %u: homography %u, border %u, margin %u, decode %u, duplicates %u, detections %u\n",
+                       td->nquads, qs->nhomography_failed, qs->nborder_rejected, qs->nmargin_rejected,
+                       qs->ndecode_failed, qs->nduplicates, qs->ndetections);
+
+                // one family, so every quad is decoded at most once.
+                double ndecoded = td->nquads > qs->nhomography_failed ? td->nquads - qs->nhomography_failed : 1;
+                printf("rejected while decoding: border %.1f%%, margin %.1f%%, lookup %.1f%%\n",
+                       100.0 * qs->nborder_rejected / ndecoded, 100.0 * qs->nmargin_rejected / ndecoded,
+                       100.0 * qs->ndecode_failed / ndecoded);
+                printf("refined: pose %u, decode %u\n", qs->nrefine_pose, qs->nrefine_decode);
+
+                const char *names[] = { "maxima", "agg" };
+                for (int i = 0; i < 2; i++) {
+                    struct apriltag_segment_stats *ss = &td->segment_stats;
+                    printf("segment %-6s: %6u clusters, %6u segmented, %6u accepted, %10.3f ms\n",
+                           names[i], ss->nclusters[i], ss->nsegmented[i], ss->naccepted[i],
+                           ss->utime[i] / 1.0E3);
+                }
             }
 
             total_quads += td->nquads;
@@ -240,6 +316,7 @@ int main(int argc, char *argv[])
 
     // don't deallocate contents of inputs; those are the argv
     apriltag_detector_destroy(td);
+    apriltag_decode_index_release(index);
 
     tag36h11_destroy(tf);
     return 0;
@@ -0,0 +1,512 @@
+/* Copyright (C) 2013-2016, The Regents of The University of Michigan.
+All rights reserved.
+
+This software was developed in the APRIL Robotics Lab under the
+direction of Edwin Olson, ebolson@umich.edu. This software may be
+available under alternative licensing terms; contact the address above.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those
+of the authors and should not be interpreted as representing official policies,
+either expressed or implied, of the Regents of The University of Michigan.
+*/
+
+
+// Decode latency of the table and multi-index decoders for each tag
+// family, and the time to build each index versus loading it from a
+// file. Every query is also checked: bit errors within range must
+// decode to the right id and orientation, the two decoders must agree
+// wherever both apply, and a loaded index must match the one saved.
+//
+// Also times the geometry-specialized quad sampling kernels against
+// the generic one on rendered tags; both must read the same code.
+//
+// usage: decode_bench [nqueries [max table bits]]
+//
+// The table decoder is only run up to 2 bits by default, since at 3
+// bits a 36-bit family needs hundreds of MB.
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cstdlib>
+#include <cstdio>
+#include <cmath>
+#include <string>
+#include <stdint.h>
+
+#include "apriltag.h"
+#include "tag36h11.h"
+#include "tag36h10.h"
+#include "tag25h9.h"
+#include "tag25h7.h"
+#include "tag16h5.h"
+#include "common/time_util.h"
+#include "common/homography.h"
+#include "common/homography_sample.h"
+#include "common/math_util.h"
+
+using namespace std;
+
+struct family_type
+{
+    const char *name;
+    const apriltag_family_t *(*family)();
+};
+
+struct query
+{
+    uint64_t rcode;
+    int id;       // -1 for random codes
+    int hamming;
+    int rotation;
+};
+
+struct result
+{
+    const apriltag_family_t *family;
+    int id, hamming, rotation;
+};
+
+static uint64_t rand64()
+{
+    uint64_t v = 0;
+    for (int i = 0; i < 4; i++)
+        v = (v << 16) ^ (rand() & 0xffff);
+    return v;
+}
+
+static uint64_t rotate90(uint64_t w, int d)
+{
+    uint64_t wr = 0;
+
+    for (int r = d-1; r >= 0; r--) {
+        for (int c = 0; c < d; c++) {
+            int b = r + d*c;
+            wr = (wr << 1) | ((w >> b) & 1);
+        }
+    }
+
+    return wr;
+}
+
+// Internal to apriltag.c; see quad_sample_code_geometry().
+extern "C" {
+typedef float (*quad_sample_code_t)(const apriltag_family_t *family, image_u8_t *im, const struct quad *quad,
+                                    int sampling, float min_margin, uint64_t *prcode, image_u8_t *im_samples);
+float quad_sample_code(const apriltag_family_t *family, image_u8_t *im, const struct quad *quad,
+                       int sampling, float min_margin, uint64_t *prcode, image_u8_t *im_samples);
+quad_sample_code_t quad_sample_code_kernel(uint32_t d, uint32_t black_border);
+}
+
+static double uniform(double lo, double hi)
+{
+    return lo + (hi - lo) * (rand() / (double) RAND_MAX);
+}
+
+// draws code, with a white border, onto im at the pose of quad. If
+// split_border, the white and black borders are instead both dark (0)
+// above the tag's center line and both light (255 and 250) below it.
+static void draw_tag(image_u8_t *im, const apriltag_family_t *fam, uint64_t code, const struct quad &quad,
+                     bool split_border)
+{
+    int n = fam->d + 2*fam->black_border;
+    for (int y = 0; y < im->height; y++) {
+        for (int x = 0; x < im->width; x++) {
+            double tx, ty;
+            homography33_project(quad.Hinv, x + .5, y + .5, &tx, &ty);
+
+            bool dark = split_border && ty < 0;
+            int cellx = (int) floor((tx + 1) / 2 * n), celly = (int) floor((ty + 1) / 2 * n);
+            int v = dark ? 0 : 255;
+            if (cellx >= 0 && cellx < n && celly >= 0 && celly < n) {
+                int bitx = cellx - (int) fam->black_border, bity = celly - (int) fam->black_border;
+                v = (split_border && !dark) ? 250 : 0;
+                if (bitx >= 0 && bitx < (int) fam->d && bity >= 0 && bity < (int) fam->d)
+                    v = ((code >> (fam->d*fam->d - 1 - (bity*fam->d + bitx))) & 1) ? 255 : 0;
+            }
+            im->buf[y*im->stride + x] = v;
+        }
+    }
+}
+
+// draws code, with a white border, at a random pose; returns the quad.
+static struct quad render_tag(image_u8_t *im, const apriltag_family_t *fam, uint64_t code)
+{
+    struct quad quad;
+    double p[4][2];
+
+    double cx = uniform(150, im->width - 150), cy = uniform(150, im->height - 150);
+    double size = uniform(30, 100);
+    for (int i = 0; i < 4; i++) {
+        p[i][0] = cx + size * (((i == 0 || i == 3) ? -1 : 1) + uniform(-0.2, 0.2));
+        p[i][1] = cy + size * (((i == 0 || i == 1) ? -1 : 1) + uniform(-0.2, 0.2));
+    }
+    homography33_square_to_quad(p, quad.H);
+    homography33_inverse(quad.H, quad.Hinv);
+
+    draw_tag(im, fam, code, quad, false);
+    return quad;
+}
+
+// returns ns per query.
+static bool same_results(const vector<result> &a, const vector<result> &b)
+{
+    for (size_t i = 0; i < a.size(); i++) {
+        if (a[i].id != b[i].id)
+            return false;
+        if (a[i].id >= 0 && (a[i].family != b[i].family || a[i].hamming != b[i].hamming ||
+                             a[i].rotation != b[i].rotation))
+            return false;
+    }
+    return true;
+}
+
+static double run(apriltag_decode_index_t *index, const vector<query> &queries, vector<result> &results)
+{
+    results.resize(queries.size());
+
+    int64_t utime0 = utime_now();
+    for (size_t i = 0; i < queries.size(); i++) {
+        result &r = results[i];
+        r.id = apriltag_decode_index_decode(index, queries[i].rcode, &r.family, &r.hamming, &r.rotation);
+    }
+    int64_t utime1 = utime_now();
+
+    return 1000.0 * (utime1 - utime0) / queries.size();
+}
+
+int main(int argc, char *argv[])
+{
+    int nqueries = argc > 1 ? atoi(argv[1]) : 100000;
+    int max_table_bits = argc > 2 ? atoi(argv[2]) : 2;
+
+    family_type families[] = {
+        { "tag36h11", tag36h11_family },
+        { "tag36h10", tag36h10_family },
+        { "tag25h9",  tag25h9_family },
+        { "tag25h7",  tag25h7_family },
+        { "tag16h5",  tag16h5_family },
+    };
+
+    const char *decoder_names[] = { "auto", "table", "multi" };
+    int nfailures = 0;
+
+    const char *index_path = "decode_bench.idx";
+
+    cout << "family     decoder bits  build ms   load ms       kB  probe   ns/hit  ns/miss" << endl;
+
+    for (size_t fidx = 0; fidx < sizeof(families) / sizeof(families[0]); fidx++) {
+        family_type &ft = families[fidx];
+
+        for (int bits = 0; bits <= 4; bits++) {
+            srand(bits);
+
+            const apriltag_family_t *tf = ft.family();
+            int nbits = tf->d * tf->d;
+            uint64_t codemask = nbits == 64 ? ~0ULL : (1ULL << nbits) - 1;
+
+            // half are family codes with up to bits errors, half are random.
+            vector<query> hits, misses;
+            for (int i = 0; i < nqueries / 2; i++) {
+                query q;
+                q.id = rand() % tf->ncodes;
+                q.rcode = tf->codes[q.id];
+
+                q.hamming = rand() % (bits + 1);
+                for (int nflipped = 0; nflipped < q.hamming; ) {
+                    uint64_t bit = 1ULL << (rand() % nbits);
+                    if ((q.rcode ^ tf->codes[q.id]) & bit)
+                        continue;
+                    q.rcode ^= bit;
+                    nflipped++;
+                }
+
+                int r = rand() % 4;
+                for (int k = 0; k < r; k++)
+                    q.rcode = rotate90(q.rcode, tf->d);
+                q.rotation = (4 - r) % 4;
+                hits.push_back(q);
+
+                q.rcode = rand64() & codemask;
+                q.id = -1;
+                misses.push_back(q);
+            }
+
+            // with fewer than h/2 bits corrected, a decode is unique.
+            bool unique = 2 * bits < (int) tf->h;
+
+            vector<result> reference_hits, reference_misses;
+
+            for (int decoder = APRILTAG_DECODER_TABLE; decoder <= APRILTAG_DECODER_MULTI_INDEX; decoder++) {
+                if (decoder == APRILTAG_DECODER_TABLE && bits > max_table_bits)
+                    continue;
+
+                int64_t utime0 = utime_now();
+                apriltag_decode_index_t *index =
+                    apriltag_decode_index_create(tf, bits, (enum apriltag_decoder) decoder);
+                int64_t utime1 = utime_now();
+
+                struct apriltag_decode_index_info info;
+                apriltag_decode_index_get_info(index, &info);
+
+                vector<result> rhits, rmisses;
+                double hit_ns = run(index, hits, rhits);
+                double miss_ns = run(index, misses, rmisses);
+
+                int nerrors = 0;
+
+                // round trip through a file
+                double load_ms = -1;
+                if (apriltag_decode_index_save(index, index_path)) {
+                    cout << "failed to save " << index_path << endl;
+                    nerrors++;
+                } else {
+                    int64_t load_utime0 = utime_now();
+                    apriltag_decode_index_t *loaded = apriltag_decode_index_load(tf, index_path);
+                    load_ms = (utime_now() - load_utime0) / 1000.0;
+
+                    vector<result> lhits, lmisses;
+                    if (loaded == NULL) {
+                        cout << "failed to load " << index_path << endl;
+                        nerrors++;
+                    } else {
+                        run(loaded, hits, lhits);
+                        run(loaded, misses, lmisses);
+                        if (!same_results(rhits, lhits) || !same_results(rmisses, lmisses)) {
+                            cout << "loaded index decodes differently" << endl;
+                            nerrors++;
+                        }
+                        apriltag_decode_index_release(loaded);
+                    }
+                    remove(index_path);
+                }
+
+                for (size_t i = 0; i < hits.size(); i++) {
+                    const query &q = hits[i];
+                    const result &r = rhits[i];
+                    if (unique && (r.id != q.id || r.hamming != q.hamming || r.rotation != q.rotation))
+                        nerrors++;
+                }
+
+                if (unique && decoder == APRILTAG_DECODER_TABLE) {
+                    reference_hits = rhits;
+                    reference_misses = rmisses;
+                } else if (unique && !reference_misses.empty()) {
+                    if (!same_results(reference_misses, rmisses))
+                        nerrors++;
+                }
+
+                cout << setw(10) << left << ft.name << " "
+                     << setw(7) << decoder_names[decoder] << right
+                     << setw(5) << bits
+                     << setw(10) << fixed << setprecision(3) << (utime1 - utime0) / 1000.0
+                     << setw(10) << load_ms
+                     << setw(9) << setprecision(1) << info.nbytes / 1024.0
+                     << setw(7) << setprecision(2) << info.avg_probe_length
+                     << setw(9) << setprecision(1) << hit_ns
+                     << setw(9) << miss_ns;
+                if (nerrors)
+                    cout << "  " << nerrors << " errors";
+                cout << endl;
+
+                nfailures += nerrors;
+                apriltag_decode_index_release(index);
+            }
+        }
+    }
+
+    // One index for two families of the same geometry, against one
+    // index per family probed in turn (as a detector does).
+    cout << endl << "family             decoder bits  ns/query (merged)  ns/query (separate)" << endl;
+
+    const apriltag_family_t *fams[2] = { tag36h11_family(), tag36h10_family() };
+    srand(0);
+
+    vector<query> queries;
+    for (int i = 0; i < nqueries; i++) {
+        query q;
+        const apriltag_family_t *tf = fams[rand() % 2];
+        q.rcode = (i % 3) ? tf->codes[rand() % tf->ncodes] ^ (1ULL << (rand() % 36)) : rand64() & ((1ULL << 36) - 1);
+        queries.push_back(q);
+    }
+
+    for (int decoder = APRILTAG_DECODER_TABLE; decoder <= APRILTAG_DECODER_MULTI_INDEX; decoder++) {
+        for (int bits = 1; bits <= 2; bits++) {
+            apriltag_decode_index_t *merged =
+                apriltag_decode_index_create_families(fams, 2, bits, (enum apriltag_decoder) decoder);
+            apriltag_decode_index_t *separate[2];
+            for (int f = 0; f < 2; f++)
+                separate[f] = apriltag_decode_index_create(fams[f], bits, (enum apriltag_decoder) decoder);
+
+            vector<result> rmerged;
+            double merged_ns = run(merged, queries, rmerged);
+
+            int64_t utime0 = utime_now();
+            int nseparate = 0;
+            for (size_t i = 0; i < queries.size(); i++) {
+                for (int f = 0; f < 2; f++) {
+                    result r;
+                    r.id = apriltag_decode_index_decode(separate[f], queries[i].rcode, &r.family, &r.hamming, &r.rotation);
+                    nseparate += r.id >= 0;
+                }
+            }
+            double separate_ns = 1000.0 * (utime_now() - utime0) / queries.size();
+
+            // every decode must be a code of its family within range.
+            int nerrors = 0, nmerged = 0;
+            for (size_t i = 0; i < queries.size(); i++) {
+                const result &r = rmerged[i];
+                if (r.id < 0)
+                    continue;
+
+                nmerged++;
+                uint64_t rcode = queries[i].rcode;
+                for (int k = 0; k < r.rotation; k++)
+                    rcode = rotate90(rcode, 6);
+
+                if (r.family != fams[0] && r.family != fams[1])
+                    nerrors++;
+                else if (popcount64(rcode ^ r.family->codes[r.id]) != r.hamming || r.hamming > bits)
+                    nerrors++;
+            }
+
+            // a quad decodes as at most one family with a merged index.
+            if (nmerged > nseparate || nmerged == 0)
+                nerrors++;
+
+            cout << setw(18) << left << "tag36h11+tag36h10" << " "
+                 << setw(7) << decoder_names[decoder] << right
+                 << setw(5) << bits
+                 << setw(19) << fixed << setprecision(1) << merged_ns
+                 << setw(21) << separate_ns;
+            if (nerrors)
+                cout << "  " << nerrors << " errors";
+            cout << endl;
+
+            nfailures += nerrors;
+            apriltag_decode_index_release(merged);
+            for (int f = 0; f < 2; f++)
+                apriltag_decode_index_release(separate[f]);
+        }
+    }
+
+    cout << endl << "family     kernel ns/quad (generic)  ns/quad (specialized)" << endl;
+
+    image_u8_t *im = image_u8_create(400, 400);
+
+    for (size_t fidx = 0; fidx < sizeof(families) / sizeof(families[0]); fidx++) {
+        const family_type &ft = families[fidx];
+        const apriltag_family_t *fam = ft.family();
+
+        quad_sample_code_t kernel = quad_sample_code_kernel(fam->d, fam->black_border);
+        int nerrors = 0;
+
+        const int ntags = 20, nreps = 1 + nqueries / 200;
+        int64_t generic_us = 0, specialized_us = 0;
+
+        for (int t = 0; t < ntags; t++) {
+            uint64_t code = fam->codes[rand() % fam->ncodes];
+            struct quad quad = render_tag(im, fam, code);
+
+            for (int sampling = HOMOGRAPHY_SAMPLE_NEAREST; sampling <= HOMOGRAPHY_SAMPLE_BILINEAR; sampling++) {
+                uint64_t rcode0 = 0, rcode1 = 0;
+                float margin0 = 0, margin1 = 0;
+
+                int64_t utime0 = utime_now();
+                for (int rep = 0; rep < nreps; rep++)
+                    margin0 = quad_sample_code(fam, im, &quad, sampling, -1, &rcode0, NULL);
+                int64_t utime1 = utime_now();
+                for (int rep = 0; rep < nreps; rep++)
+                    margin1 = kernel(fam, im, &quad, sampling, -1, &rcode1, NULL);
+                int64_t utime2 = utime_now();
+
+                generic_us += utime1 - utime0;
+                specialized_us += utime2 - utime1;
+
+                if (rcode0 != code || rcode1 != code || margin0 != margin1)
+                    nerrors++;
+            }
+        }
+
+        double nquads = 2.0 * ntags * nreps;
+        cout << setw(10) << left << ft.name << " "
+             << setw(6) << (kernel == quad_sample_code ? "none" : "d" + to_string(fam->d)) << right
+             << setw(20) << fixed << setprecision(1) << 1000.0 * generic_us / nquads
+             << setw(23) << 1000.0 * specialized_us / nquads;
+        if (nerrors)
+            cout << "  " << nerrors << " errors";
+        cout << endl;
+
+        nfailures += nerrors;
+    }
+
+    image_u8_destroy(im);
+
+    // the early-out of the sampling kernels must not reject a quad
+    // whose margin reaches min_margin. Crop a tag to a band across its
+    // middle and split its border lighting there: the gray models, fit
+    // to the few border samples left, extrapolate to thresholds well
+    // outside [0, 255] at the bit cells.
+    cout << endl << "family     early-out quads  errors (extrapolated gray models)" << endl;
+
+    im = image_u8_create(200, 130);
+
+    struct quad band;
+    double band_p[4][2] = { { 20, im->height / 2.0 - 80 }, { 180, im->height / 2.0 - 80 },
+                            { 180, im->height / 2.0 + 80 }, { 20, im->height / 2.0 + 80 } };
+    homography33_square_to_quad(band_p, band.H);
+    homography33_inverse(band.H, band.Hinv);
+
+    for (size_t fidx = 0; fidx < sizeof(families) / sizeof(families[0]); fidx++) {
+        const family_type &ft = families[fidx];
+        const apriltag_family_t *fam = ft.family();
+
+        quad_sample_code_t kernel = quad_sample_code_kernel(fam->d, fam->black_border);
+        int nquads = 0, nerrors = 0;
+
+        for (uint32_t c = 0; c < fam->ncodes; c++) {
+            draw_tag(im, fam, fam->codes[c], band, true);
+
+            for (int sampling = HOMOGRAPHY_SAMPLE_NEAREST; sampling <= HOMOGRAPHY_SAMPLE_BILINEAR; sampling++) {
+                uint64_t rcode;
+                float margin = quad_sample_code(fam, im, &band, sampling, -1, &rcode, NULL);
+                if (margin <= 0)
+                    continue;
+
+                nquads++;
+                if (quad_sample_code(fam, im, &band, sampling, margin, &rcode, NULL) != margin ||
+                    kernel(fam, im, &band, sampling, margin, &rcode, NULL) != margin ||
+                    quad_sample_code(fam, im, &band, sampling, margin + 1, &rcode, NULL) >= 0)
+                    nerrors++;
+            }
+        }
+
+        cout << setw(10) << left << ft.name << right << setw(16) << nquads << setw(8) << nerrors << endl;
+
+        nfailures += nerrors;
+    }
+
+    image_u8_destroy(im);
+
+    return nfailures ? 1 : 0;
+}
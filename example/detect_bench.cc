@@ -0,0 +1,284 @@
+/* Copyright (C) 2013-2016, The Regents of The University of Michigan.
+All rights reserved.
+
+This software was developed in the APRIL Robotics Lab under the
+direction of Edwin Olson, ebolson@umich.edu. This software may be
+available under alternative licensing terms; contact the address above.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those
+of the authors and should not be interpreted as representing official policies,
+either expressed or implied, of the Regents of The University of Michigan.
+*/
+
+// Detection time on the sample image and on a synthetic scene of many
+// tag36h11 tags at random poses, without refine_pose and with each
+// refine_pose_mode, refining every quad or (decode_first) only the
+// ones that decode. On the synthetic scene, the detected corners are
+// compared with the true ones, and every tag must be found, and
+// apriltag_detector_detect_into() must agree with apriltag_detector_detect().
+//
+// usage: detect_bench [iters [ntags]]
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <stdint.h>
+
+#include "apriltag.h"
+#include "tag36h11.h"
+#include "common/homography.h"
+#include "common/image_u8.h"
+#include "common/time_util.h"
+
+using namespace std;
+
+struct tag_truth
+{
+    int id;
+
+    // image coordinates of tag coordinates (-1,-1), (1,-1), (1,1), (-1,1)
+    double p[4][2];
+};
+
+static double uniform(double lo, double hi)
+{
+    return lo + (hi - lo) * (rand() / (double) RAND_MAX);
+}
+
+// Draws ids 0..ntags-1 of fam, one per cell of a grid, each with a
+// random size, rotation and perspective. Pixels are 4x4 supersampled.
+static image_u8_t *render_scene(const apriltag_family_t *fam, int width, int height, int ntags,
+                                vector<tag_truth> &truth)
+{
+    image_u8_t *im = image_u8_create(width, height);
+    for (int y = 0; y < height; y++)
+        for (int x = 0; x < width; x++)
+            im->buf[y*im->stride + x] = 96 + 64 * x / width + (rand() % 7) - 3;
+
+    int ncols = (int) ceil(sqrt(ntags * (double) width / height));
+    int nrows = (ntags + ncols - 1) / ncols;
+    double cellw = (double) width / ncols, cellh = (double) height / nrows;
+
+    truth.clear();
+
+    for (int id = 0; id < ntags; id++) {
+        double cx = (id % ncols + .5) * cellw + uniform(-.05, .05) * cellw;
+        double cy = (id / ncols + .5) * cellh + uniform(-.05, .05) * cellh;
+        double size = uniform(.18, .28) * fmin(cellw, cellh);
+        double theta = uniform(-M_PI, M_PI);
+        double c = cos(theta), s = sin(theta);
+
+        tag_truth t;
+        t.id = id;
+        for (int i = 0; i < 4; i++) {
+            double x = size * (((i == 0 || i == 3) ? -1 : 1) + uniform(-.15, .15));
+            double y = size * (((i == 0 || i == 1) ? -1 : 1) + uniform(-.15, .15));
+            t.p[i][0] = cx + c*x - s*y;
+            t.p[i][1] = cy + s*x + c*y;
+        }
+
+        double H[9], Hinv[9];
+        if (homography33_square_to_quad(t.p, H) || homography33_inverse(H, Hinv))
+            continue;
+
+        // apriltag_to_image() is the tag with a one-pixel white border;
+        // tag coordinates [-1, 1] span its black border.
+        image_u8_t *tag = apriltag_to_image(fam, id);
+        int n = fam->d + 2*fam->black_border;
+
+        int x0 = max(0, (int) (cx - 2*size)), x1 = min(width - 1, (int) (cx + 2*size));
+        int y0 = max(0, (int) (cy - 2*size)), y1 = min(height - 1, (int) (cy + 2*size));
+
+        for (int y = y0; y <= y1; y++) {
+            for (int x = x0; x <= x1; x++) {
+                int sum = 0, ninside = 0;
+
+                for (int sy = 0; sy < 4; sy++) {
+                    for (int sx = 0; sx < 4; sx++) {
+                        double tx, ty;
+                        homography33_project(Hinv, x + (sx + .5) / 4, y + (sy + .5) / 4, &tx, &ty);
+
+                        int u = (int) floor((tx + 1) / 2 * n) + 1;
+                        int v = (int) floor((ty + 1) / 2 * n) + 1;
+                        if (u < 0 || v < 0 || u >= tag->width || v >= tag->height)
+                            continue;
+
+                        sum += tag->buf[v*tag->stride + u];
+                        ninside++;
+                    }
+                }
+
+                if (ninside) {
+                    int bg = im->buf[y*im->stride + x];
+                    im->buf[y*im->stride + x] = (sum + (16 - ninside) * bg) / 16;
+                }
+            }
+        }
+
+        image_u8_destroy(tag);
+        truth.push_back(t);
+    }
+
+    return im;
+}
+
+struct bench_result
+{
+    double ms;
+    int ndetections;
+    int nfound;        // of the true tags
+    double corner_rms; // px, over found tags
+};
+
+static bench_result run(apriltag_detector_t *td, image_u8_t *im, int iters, const vector<tag_truth> &truth)
+{
+    bench_result r = { 0, 0, 0, 0 };
+    double err2 = 0;
+
+    for (int iter = 0; iter < iters; iter++) {
+        int64_t utime0 = utime_now();
+        zarray_t *detections = apriltag_detector_detect(td, im);
+        r.ms += (utime_now() - utime0) / 1000.0 / iters;
+
+        if (iter == 0) {
+            r.ndetections = zarray_size(detections);
+
+            for (size_t t = 0; t < truth.size(); t++) {
+                for (int i = 0; i < zarray_size(detections); i++) {
+                    apriltag_detection_t *det;
+                    zarray_get(detections, i, &det);
+                    if (det->id != truth[t].id || det->hamming != 0)
+                        continue;
+
+                    // the detection may start at any corner.
+                    for (int k = 0; k < 4; k++) {
+                        double best = HUGE_VAL;
+                        for (int j = 0; j < 4; j++) {
+                            double dx = det->p[j][0] - truth[t].p[k][0], dy = det->p[j][1] - truth[t].p[k][1];
+                            best = fmin(best, dx*dx + dy*dy);
+                        }
+                        err2 += best;
+                    }
+                    r.nfound++;
+                    break;
+                }
+            }
+        }
+
+        apriltag_detections_destroy(detections);
+    }
+
+    if (r.nfound)
+        r.corner_rms = sqrt(err2 / (4 * r.nfound));
+
+    return r;
+}
+
+int main(int argc, char *argv[])
+{
+    int iters = argc > 1 ? atoi(argv[1]) : 5;
+    int ntags = argc > 2 ? atoi(argv[2]) : 48;
+
+    srand(0);
+
+    const apriltag_family_t *tf = tag36h11_family();
+
+    apriltag_detector_t *td = apriltag_detector_create();
+    apriltag_detector_add_family(td, tf);
+
+    vector<tag_truth> truth;
+    image_u8_t *synthetic = render_scene(tf, 1280, 960, ntags, truth);
+    image_u8_t *sample = image_u8_create_from_pnm(APRIL_TAG_DATA_DIR);
+
+    int nfailures = 0;
+
+    // refine_pose off, then each refine_pose_mode.
+    const char *refine_names[] = { "off", "hill-climb", "gauss-newton" };
+
+    cout << "scene      refine_pose  decode_first  ms/frame  detections  found  corner rms" << endl;
+
+    for (int scene = 0; scene < 2; scene++) {
+        image_u8_t *im = scene ? synthetic : sample;
+        if (im == NULL)
+            continue;
+
+        for (int config = 0; config < 5; config++) {
+            int refine = (config + 1) / 2;
+            td->refine_pose = refine > 0;
+            td->refine_pose_mode = refine == 2 ? APRILTAG_REFINE_POSE_GAUSS_NEWTON
+                                               : APRILTAG_REFINE_POSE_HILL_CLIMB;
+            td->decode_first = config > 0 && (config & 1) == 0;
+
+            vector<tag_truth> none;
+            bench_result r = run(td, im, iters, scene ? truth : none);
+
+            cout << setw(10) << left << (scene ? "synthetic" : "sample") << " " << right
+                 << setw(12) << left << refine_names[refine] << right
+                 << setw(13) << td->decode_first
+                 << setw(10) << fixed << setprecision(2) << r.ms
+                 << setw(12) << r.ndetections;
+            if (scene) {
+                cout << setw(4) << r.nfound << "/" << left << setw(3) << truth.size() << right
+                     << setw(10) << setprecision(3) << r.corner_rms;
+                if (r.nfound != (int) truth.size())
+                    nfailures++;
+            }
+            cout << endl;
+        }
+    }
+
+    // apriltag_detector_detect_into(), reusing its output array, must
+    // give the same detections as apriltag_detector_detect().
+    zarray_t *values = zarray_create(sizeof(apriltag_detection_t));
+    for (int iter = 0; iter < 2; iter++) {
+        zarray_t *detections = apriltag_detector_detect(td, synthetic);
+        apriltag_detector_detect_into(td, synthetic, values);
+
+        int same = zarray_size(values) == zarray_size(detections);
+        for (int i = 0; same && i < zarray_size(values); i++) {
+            apriltag_detection_t *det, *value;
+            zarray_get(detections, i, &det);
+            zarray_get_volatile(values, i, &value);
+            same = det->family == value->family && det->id == value->id &&
+                !memcmp(det->p, value->p, sizeof(det->p));
+        }
+
+        if (!same) {
+            cout << "apriltag_detector_detect_into() differs from apriltag_detector_detect()" << endl;
+            nfailures++;
+        }
+
+        apriltag_detections_destroy(detections);
+    }
+    zarray_destroy(values);
+
+    if (sample)
+        image_u8_destroy(sample);
+    image_u8_destroy(synthetic);
+    apriltag_detector_destroy(td);
+
+    return nfailures ? 1 : 0;
+}
@@ -0,0 +1,198 @@
+/* Copyright (C) 2013-2016, The Regents of The University of Michigan.
+All rights reserved.
+
+This software was developed in the APRIL Robotics Lab under the
+direction of Edwin Olson, ebolson@umich.edu. This software may be
+available under alternative licensing terms; contact the address above.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those
+of the authors and should not be interpreted as representing official policies,
+either expressed or implied, of the Regents of The University of Michigan.
+*/
+
+// Times the fixed-size convex polygon routines of g2d against the
+// zarray polygon versions on random convex polygons of 3 to 6
+// vertices, and checks that both give the same answers.
+//
+// usage: g2d_bench [npairs]
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+#include <stdint.h>
+
+#include "common/g2d.h"
+#include "common/zarray.h"
+#include "common/time_util.h"
+
+using namespace std;
+
+struct polygon
+{
+    int n;
+    double p[6][2];
+    zarray_t *poly;
+};
+
+static double uniform(double lo, double hi)
+{
+    return lo + (hi - lo) * (rand() / (double) RAND_MAX);
+}
+
+// a random convex polygon near (cx, cy), in either winding.
+static polygon random_polygon(double cx, double cy, double size)
+{
+    polygon pg;
+
+    do {
+        pg.n = 3 + rand() % 4;
+        double theta = uniform(0, 2*M_PI);
+        double dir = (rand() & 1) ? 1 : -1;
+
+        for (int i = 0; i < pg.n; i++) {
+            double r = size * uniform(.8, 1.2);
+            double t = theta + dir * 2*M_PI * (i + uniform(-.3, .3)) / pg.n;
+            pg.p[i][0] = cx + r*cos(t);
+            pg.p[i][1] = cy + r*sin(t);
+        }
+    } while (!g2d_convex_is_convex(pg.p, pg.n));
+
+    pg.poly = g2d_polygon_create_data(pg.p, pg.n);
+    return pg;
+}
+
+int main(int argc, char *argv[])
+{
+    int npairs = argc > 1 ? atoi(argv[1]) : 20000;
+
+    srand(0);
+
+    vector<polygon> a, b;
+    vector<double> q;
+    for (int i = 0; i < npairs; i++) {
+        a.push_back(random_polygon(uniform(0, 100), uniform(0, 100), uniform(2, 30)));
+        b.push_back(random_polygon(uniform(0, 100), uniform(0, 100), uniform(2, 30)));
+        q.push_back(uniform(0, 100));
+        q.push_back(uniform(0, 100));
+    }
+
+    int nfailures = 0;
+    int64_t t0, t1, t2;
+    int nconvex, nzarray;
+
+    cout << "routine              convex ns  zarray ns  (per call, " << npairs << " pairs)" << endl;
+
+    // overlap
+    vector<int> convex(npairs), reference(npairs);
+    t0 = utime_now();
+    for (int i = 0; i < npairs; i++)
+        convex[i] = g2d_convex_overlaps_convex(a[i].p, a[i].n, b[i].p, b[i].n);
+    t1 = utime_now();
+    for (int i = 0; i < npairs; i++)
+        reference[i] = g2d_polygon_overlaps_polygon(a[i].poly, b[i].poly);
+    t2 = utime_now();
+
+    nconvex = nzarray = 0;
+    for (int i = 0; i < npairs; i++) {
+        nconvex += convex[i];
+        nzarray += reference[i];
+        nfailures += convex[i] != reference[i];
+    }
+    cout << "overlaps          " << fixed << setprecision(1)
+         << setw(12) << 1.0E3 * (t1 - t0) / npairs << setw(11) << 1.0E3 * (t2 - t1) / npairs
+         << "  (" << nconvex << " vs " << nzarray << " overlapping)" << endl;
+
+    // point containment
+    t0 = utime_now();
+    for (int i = 0; i < npairs; i++)
+        convex[i] = g2d_convex_contains_point(a[i].p, a[i].n, &q[2*i]);
+    t1 = utime_now();
+    for (int i = 0; i < npairs; i++)
+        reference[i] = g2d_polygon_contains_point(a[i].poly, &q[2*i]);
+    t2 = utime_now();
+
+    nconvex = nzarray = 0;
+    for (int i = 0; i < npairs; i++) {
+        nconvex += convex[i];
+        nzarray += reference[i];
+        nfailures += convex[i] != reference[i];
+    }
+    cout << "contains point    "
+         << setw(12) << 1.0E3 * (t1 - t0) / npairs << setw(11) << 1.0E3 * (t2 - t1) / npairs
+         << "  (" << nconvex << " vs " << nzarray << " inside)" << endl;
+
+    // polygon containment: shrink b around a point of a so that some
+    // are contained.
+    for (int i = 0; i < npairs; i++) {
+        for (int k = 0; k < b[i].n; k++) {
+            for (int j = 0; j < 2; j++)
+                b[i].p[k][j] = a[i].p[0][j] + (b[i].p[k][j] - b[i].p[0][j]) * .1
+                    + (a[i].p[1][j] + a[i].p[2][j] - 2*a[i].p[0][j]) * .3;
+        }
+        zarray_destroy(b[i].poly);
+        b[i].poly = g2d_polygon_create_data(b[i].p, b[i].n);
+    }
+
+    t0 = utime_now();
+    for (int i = 0; i < npairs; i++)
+        convex[i] = g2d_convex_contains_convex(a[i].p, a[i].n, b[i].p, b[i].n);
+    t1 = utime_now();
+    for (int i = 0; i < npairs; i++)
+        reference[i] = g2d_polygon_contains_polygon(a[i].poly, b[i].poly);
+    t2 = utime_now();
+
+    nconvex = nzarray = 0;
+    for (int i = 0; i < npairs; i++) {
+        nconvex += convex[i];
+        nzarray += reference[i];
+        nfailures += convex[i] != reference[i];
+    }
+    cout << "contains polygon  "
+         << setw(12) << 1.0E3 * (t1 - t0) / npairs << setw(11) << 1.0E3 * (t2 - t1) / npairs
+         << "  (" << nconvex << " vs " << nzarray << " contained)" << endl;
+
+    // area, against a triangle fan. There is no zarray version.
+    double max_err = 0;
+    for (int i = 0; i < npairs; i++) {
+        double fan = 0;
+        for (int k = 1; k + 1 < a[i].n; k++) {
+            const double *p0 = a[i].p[0], *p1 = a[i].p[k], *p2 = a[i].p[k+1];
+            fan += ((p1[0] - p0[0])*(p2[1] - p0[1]) - (p1[1] - p0[1])*(p2[0] - p0[0])) / 2;
+        }
+        double err = fabs(g2d_convex_signed_area(a[i].p, a[i].n) - fan);
+        max_err = fmax(max_err, err);
+        nfailures += err > 1e-9 * fabs(fan);
+    }
+    cout << "signed area        max error " << scientific << setprecision(2) << max_err << endl;
+
+    for (int i = 0; i < npairs; i++) {
+        zarray_destroy(a[i].poly);
+        zarray_destroy(b[i].poly);
+    }
+
+    cout << nfailures << " failures" << endl;
+
+    return nfailures ? 1 : 0;
+}
@@ -0,0 +1,237 @@
+/* Copyright (C) 2013-2016, The Regents of The University of Michigan.
+All rights reserved.
+
+This software was developed in the APRIL Robotics Lab under the
+direction of Edwin Olson, ebolson@umich.edu. This software may be
+available under alternative licensing terms; contact the address above.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those
+of the authors and should not be interpreted as representing official policies,
+either expressed or implied, of the Regents of The University of Michigan.
+*/
+
+// Checks homography33_square_to_quad() (closed form) against
+// homography_compute() (SVD) on randomized quads, and
+// homography33_sample_grid() against projecting every point.
+
+#include <iostream>
+#include <cmath>
+#include <cstdlib>
+
+#include "common/homography.h"
+#include "common/homography_sample.h"
+#include "common/zarray.h"
+#include "common/matd.h"
+#include "common/image_u8.h"
+#include "common/time_util.h"
+
+using namespace std;
+
+static double uniform(double lo, double hi)
+{
+    return lo + (hi - lo) * (rand() / (double) RAND_MAX);
+}
+
+// the straightforward version of homography33_sample_grid().
+static float sample_reference(const double *H, const image_u8_t *im, int interpolation, double tx, double ty)
+{
+    double px, py;
+    homography33_project(H, tx, ty, &px, &py);
+
+    int ix = px, iy = py;
+    if (ix < 0 || iy < 0 || ix >= im->width || iy >= im->height)
+        return -1;
+
+    if (interpolation == HOMOGRAPHY_SAMPLE_NEAREST)
+        return im->buf[iy*im->stride + ix];
+
+    double fx = px - .5, fy = py - .5;
+    int x0 = floor(fx), y0 = floor(fy);
+    double ax = fx - x0, ay = fy - y0;
+
+    double v = 0;
+    for (int dy = 0; dy < 2; dy++) {
+        for (int dx = 0; dx < 2; dx++) {
+            int x = min(max(x0 + dx, 0), im->width - 1);
+            int y = min(max(y0 + dy, 0), im->height - 1);
+            v += (dx ? ax : 1 - ax) * (dy ? ay : 1 - ay) * im->buf[y*im->stride + x];
+        }
+    }
+    return v;
+}
+
+// Samples the bit cells of random tags straddling the image border,
+// with both interpolations. Returns the number of failures.
+static int test_sample_grid()
+{
+    image_u8_t *im = image_u8_create(640, 480);
+    for (int y = 0; y < im->height; y++)
+        for (int x = 0; x < im->width; x++)
+            im->buf[y*im->stride + x] = rand() & 0xff;
+
+    const int ntrials = 10000;
+    int nfailures = 0;
+    int64_t ngrid = 0, nreference = 0;
+    double grid_s = 0, reference_s = 0;
+
+    for (int trial = 0; trial < ntrials; trial++) {
+        double cx = uniform(-20, 660), cy = uniform(-20, 500);
+        double size = uniform(3, 100);
+
+        double p[4][2];
+        for (int i = 0; i < 4; i++) {
+            p[i][0] = cx + size * (((i == 0 || i == 3) ? -1 : 1) + uniform(-0.3, 0.3));
+            p[i][1] = cy + size * (((i == 0 || i == 1) ? -1 : 1) + uniform(-0.3, 0.3));
+        }
+
+        double H[9];
+        if (homography33_square_to_quad(p, H))
+            continue;
+
+        int d = 4 + trial % 5;
+        double bit_size = 2.0 / (d + 2);
+        double x0 = -1 + 1.5*bit_size, y0 = x0;
+        int interpolation = (trial & 1) ? HOMOGRAPHY_SAMPLE_BILINEAR : HOMOGRAPHY_SAMPLE_NEAREST;
+
+        float values[64], expected[64];
+
+        int64_t t0 = utime_now();
+        homography33_sample_grid(H, im, interpolation, x0, y0, bit_size, 0, 0, bit_size, d, d, values);
+        int64_t t1 = utime_now();
+        for (int j = 0; j < d; j++)
+            for (int i = 0; i < d; i++)
+                expected[j*d + i] = sample_reference(H, im, interpolation, x0 + i*bit_size, y0 + j*bit_size);
+        int64_t t2 = utime_now();
+
+        grid_s += (t1 - t0) / 1.0E6;
+        reference_s += (t2 - t1) / 1.0E6;
+        ngrid += d*d;
+        nreference += d*d;
+
+        for (int k = 0; k < d*d; k++) {
+            // stepping the coordinates rounds differently, so a point
+            // within rounding error of a pixel boundary may land in
+            // either pixel. Random quads essentially never do that.
+            if (fabs(values[k] - expected[k]) > 1e-3) {
+                cout << "trial " << trial << ": sample " << k << " is " << values[k]
+                     << ", expected " << expected[k] << endl;
+                nfailures++;
+                break;
+            }
+        }
+    }
+
+    image_u8_destroy(im);
+
+    cout << ntrials << " grids, " << nfailures << " failures, "
+         << 1.0E9 * grid_s / ngrid << " ns/sample stepped, "
+         << 1.0E9 * reference_s / nreference << " ns/sample projected" << endl;
+
+    return nfailures;
+}
+
+int main(int argc, char *argv[])
+{
+    srand(0);
+
+    const int ntrials = 10000;
+    int nfailures = 0;
+    double max_err = 0;
+
+    for (int trial = 0; trial < ntrials; trial++) {
+        // a random, roughly square tag with perspective distortion
+        double cx = uniform(50, 1000), cy = uniform(50, 1000);
+        double size = uniform(5, 300);
+        double theta = uniform(-M_PI, M_PI);
+        double c = cos(theta), s = sin(theta);
+
+        double p[4][2];
+        zarray_t *correspondences = zarray_create(sizeof(float[4]));
+
+        for (int i = 0; i < 4; i++) {
+            double tx = (i == 0 || i == 3) ? -1 : 1;
+            double ty = (i == 0 || i == 1) ? -1 : 1;
+
+            double x = size * (tx + uniform(-0.3, 0.3));
+            double y = size * (ty + uniform(-0.3, 0.3));
+
+            p[i][0] = cx + c*x - s*y;
+            p[i][1] = cy + s*x + c*y;
+
+            // homography_compute takes floats, so give both the same input.
+            p[i][0] = (float) p[i][0];
+            p[i][1] = (float) p[i][1];
+
+            float corr[4] = { (float) tx, (float) ty, (float) p[i][0], (float) p[i][1] };
+            zarray_add(correspondences, corr);
+        }
+
+        matd_t *Hsvd = homography_compute(correspondences, HOMOGRAPHY_COMPUTE_FLAG_SVD);
+        zarray_destroy(correspondences);
+
+        double H[9], Hinv[9];
+        if (homography33_square_to_quad(p, H) || homography33_inverse(H, Hinv)) {
+            cout << "trial " << trial << ": unexpected degenerate quad" << endl;
+            nfailures++;
+            matd_destroy(Hsvd);
+            continue;
+        }
+
+        // the two homographies differ in scale, so compare projections.
+        double err = 0;
+        for (double ty = -1.5; ty <= 1.5; ty += 0.25) {
+            for (double tx = -1.5; tx <= 1.5; tx += 0.25) {
+                double x0, y0, x1, y1, rx, ry;
+                homography_project(Hsvd, tx, ty, &x0, &y0);
+                homography33_project(H, tx, ty, &x1, &y1);
+                err = fmax(err, fabs(x0 - x1) + fabs(y0 - y1));
+
+                // and back again through the inverse.
+                homography33_project(Hinv, x1, y1, &rx, &ry);
+                err = fmax(err, fabs(rx - tx) + fabs(ry - ty));
+            }
+        }
+
+        max_err = fmax(max_err, err);
+        if (err > 1e-6) {
+            cout << "trial " << trial << ": error " << err << endl;
+            nfailures++;
+        }
+
+        matd_destroy(Hsvd);
+    }
+
+    // degenerate input must be reported.
+    double collinear[4][2] = { { 0, 0 }, { 1, 1 }, { 2, 2 }, { 3, 3 } };
+    double H[9];
+    if (homography33_square_to_quad(collinear, H) == 0) {
+        cout << "collinear points were not rejected" << endl;
+        nfailures++;
+    }
+
+    cout << ntrials << " trials, " << nfailures << " failures, max error " << max_err << endl;
+
+    nfailures += test_sample_grid();
+
+    return nfailures ? 1 : 0;
+}
@@ -0,0 +1,295 @@
+/* Copyright (C) 2013-2016, The Regents of The University of Michigan.
+All rights reserved.
+
+This software was developed in the APRIL Robotics Lab under the
+direction of Edwin Olson, ebolson@umich.edu. This software may be
+available under alternative licensing terms; contact the address above.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those
+of the authors and should not be interpreted as representing official policies,
+either expressed or implied, of the Regents of The University of Michigan.
+*/
+
+// Times the fixed-size matd33_*/matd44_* kernels against the matd_op()
+// expressions they replace, on random matrices, and checks that both
+// give the same answers. Also times homography_to_pose() against its
+// previous matd_svd()/matd_op() polar decomposition.
+//
+// usage: matd_bench [iters]
+
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+#include <stdint.h>
+
+#include "common/matd.h"
+#include "common/homography.h"
+#include "common/time_util.h"
+
+using namespace std;
+
+static double uniform(double lo, double hi)
+{
+    return lo + (hi - lo) * (rand() / (double) RAND_MAX);
+}
+
+// a random dim x dim matrix, kept well-conditioned by a large
+// diagonal so that the inverses and polar factors are accurate.
+static void random_matrix(double *A, int dim)
+{
+    for (int i = 0; i < dim; i++)
+        for (int j = 0; j < dim; j++)
+            A[dim*i + j] = uniform(-1, 1) + (i == j ? 2*dim : 0);
+}
+
+static double max_diff(const double *a, const double *b, int n)
+{
+    double d = 0;
+    for (int i = 0; i < n; i++)
+        d = fmax(d, fabs(a[i] - b[i]));
+    return d;
+}
+
+struct bench
+{
+    const char *name;
+    int dim;
+    int nargs;
+
+    // computes the result with matd_op(), into a new matrix.
+    matd_t *(*reference)(matd_t **args);
+
+    // computes the result with the kernels.
+    void (*kernel)(double **args, double *out);
+};
+
+static matd_t *op_mmm(matd_t **m) { return matd_op("M*M*M", m[0], m[1], m[2]); }
+static matd_t *op_mmt(matd_t **m) { return matd_op("M*M'", m[0], m[1]); }
+static matd_t *op_inv(matd_t **m) { return matd_op("M^-1", m[0]); }
+static matd_t *op_mm(matd_t **m) { return matd_op("M*M", m[0], m[1]); }
+static matd_t *op_t(matd_t **m) { return matd_op("M'", m[0]); }
+
+static matd_t *op_polar(matd_t **m)
+{
+    matd_svd_t svd = matd_svd(m[0]);
+    matd_t *Q = matd_op("M*M'", svd.U, svd.V);
+    matd_destroy(svd.U);
+    matd_destroy(svd.S);
+    matd_destroy(svd.V);
+    return Q;
+}
+
+static void k33_mmm(double **a, double *out)
+{
+    double t[9];
+    matd33_multiply(a[0], a[1], t);
+    matd33_multiply(t, a[2], out);
+}
+
+static void k33_mmt(double **a, double *out) { matd33_multiply_transpose(a[0], a[1], out); }
+static void k33_inv(double **a, double *out) { matd33_inverse(a[0], out); }
+static void k33_polar(double **a, double *out) { matd33_polar(a[0], out); }
+static void k44_mm(double **a, double *out) { matd44_multiply(a[0], a[1], out); }
+static void k44_t(double **a, double *out) { matd44_transpose(a[0], out); }
+static void k44_inv(double **a, double *out) { matd44_inverse(a[0], out); }
+
+// homography_to_pose() as it was, polar decomposition by matd_svd().
+static matd_t *pose_reference(const matd_t *H, double fx, double fy, double cx, double cy)
+{
+    double R20 = MATD_EL(H, 2, 0);
+    double R21 = MATD_EL(H, 2, 1);
+    double TZ  = MATD_EL(H, 2, 2);
+    double R00 = (MATD_EL(H, 0, 0) - cx*R20) / fx;
+    double R01 = (MATD_EL(H, 0, 1) - cx*R21) / fx;
+    double TX  = (MATD_EL(H, 0, 2) - cx*TZ)  / fx;
+    double R10 = (MATD_EL(H, 1, 0) - cy*R20) / fy;
+    double R11 = (MATD_EL(H, 1, 1) - cy*R21) / fy;
+    double TY  = (MATD_EL(H, 1, 2) - cy*TZ)  / fy;
+
+    double length1 = sqrtf(R00*R00 + R10*R10 + R20*R20);
+    double length2 = sqrtf(R01*R01 + R11*R11 + R21*R21);
+    double s = 1.0 / sqrtf(length1 * length2);
+    if (TZ > 0)
+        s *= -1;
+
+    R20 *= s; R21 *= s; TZ *= s;
+    R00 *= s; R01 *= s; TX *= s;
+    R10 *= s; R11 *= s; TY *= s;
+
+    double R02 = R10*R21 - R20*R11;
+    double R12 = R20*R01 - R00*R21;
+    double R22 = R00*R11 - R10*R01;
+
+    double Rd[9] = { R00, R01, R02,
+                     R10, R11, R12,
+                     R20, R21, R22 };
+    matd_t *R = matd_create_data(3, 3, Rd);
+    matd_t *Q = op_polar(&R);
+    matd_destroy(R);
+
+    double T[3] = { TX, TY, TZ };
+    matd_t *pose = matd_identity(4);
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++)
+            MATD_EL(pose, i, j) = MATD_EL(Q, i, j);
+        MATD_EL(pose, i, 3) = T[i];
+    }
+    matd_destroy(Q);
+    return pose;
+}
+
+int main(int argc, char *argv[])
+{
+    int iters = argc > 1 ? atoi(argv[1]) : 20000;
+
+    srand(0);
+
+    const bench benches[] = {
+        { "3x3 M*M*M", 3, 3, op_mmm, k33_mmm },
+        { "3x3 M*M'", 3, 2, op_mmt, k33_mmt },
+        { "3x3 M^-1", 3, 1, op_inv, k33_inv },
+        { "3x3 polar", 3, 1, op_polar, k33_polar },
+        { "4x4 M*M", 4, 2, op_mm, k44_mm },
+        { "4x4 M'", 4, 1, op_t, k44_t },
+        { "4x4 M^-1", 4, 1, op_inv, k44_inv },
+    };
+
+    int nfailures = 0;
+
+    // each operation is timed over all of its inputs at once.
+    vector<double> data(iters * 3 * 16), out(iters * 16);
+    vector<matd_t*> m(iters * 3), expected(iters);
+
+    cout << "operation            matd_op ns  kernel ns  max difference" << endl;
+
+    for (size_t b = 0; b < sizeof(benches) / sizeof(benches[0]); b++) {
+        const bench &bn = benches[b];
+        int n = bn.dim * bn.dim;
+
+        for (int iter = 0; iter < iters; iter++) {
+            for (int i = 0; i < bn.nargs; i++) {
+                double *A = &data[(3*iter + i) * 16];
+                random_matrix(A, bn.dim);
+                m[3*iter + i] = matd_create_data(bn.dim, bn.dim, A);
+            }
+        }
+
+        int64_t t0 = utime_now();
+        for (int iter = 0; iter < iters; iter++)
+            expected[iter] = bn.reference(&m[3*iter]);
+
+        int64_t t1 = utime_now();
+        for (int iter = 0; iter < iters; iter++) {
+            double *args[3] = { &data[3*iter * 16], &data[(3*iter + 1) * 16], &data[(3*iter + 2) * 16] };
+            bn.kernel(args, &out[iter * 16]);
+        }
+        int64_t t2 = utime_now();
+
+        double max_err = 0;
+        for (int iter = 0; iter < iters; iter++) {
+            // compare relative to the size of the result.
+            double scale = 1;
+            for (int i = 0; i < n; i++)
+                scale = fmax(scale, fabs(expected[iter]->data[i]));
+            max_err = fmax(max_err, max_diff(expected[iter]->data, &out[iter * 16], n) / scale);
+
+            matd_destroy(expected[iter]);
+            for (int i = 0; i < bn.nargs; i++)
+                matd_destroy(m[3*iter + i]);
+        }
+
+        cout << setw(18) << left << bn.name << right
+             << setw(13) << fixed << setprecision(1) << 1.0E3 * (t1 - t0) / iters
+             << setw(11) << 1.0E3 * (t2 - t1) / iters
+             << setw(16) << scientific << setprecision(2) << max_err << endl;
+
+        if (max_err > 1e-9)
+            nfailures++;
+    }
+
+    // homography_to_pose() on homographies of tags in front of a camera.
+    double fx = 600, fy = 600, cx = 320, cy = 240;
+    vector<matd_t*> H(iters), pose(iters);
+
+    for (int iter = 0; iter < iters; iter++) {
+        double rvec[3] = { uniform(-.6, .6), uniform(-.6, .6), uniform(-M_PI, M_PI) };
+        double theta = sqrt(rvec[0]*rvec[0] + rvec[1]*rvec[1] + rvec[2]*rvec[2]);
+        double k[3] = { rvec[0] / theta, rvec[1] / theta, rvec[2] / theta };
+        double c = cos(theta), s = sin(theta);
+
+        // Rodrigues' formula
+        double R[9];
+        for (int i = 0; i < 3; i++)
+            for (int j = 0; j < 3; j++)
+                R[3*i + j] = (i == j ? c : 0) + (1 - c)*k[i]*k[j];
+        R[1] -= s*k[2]; R[3] += s*k[2];
+        R[2] += s*k[1]; R[6] -= s*k[1];
+        R[5] -= s*k[0]; R[7] += s*k[0];
+
+        double T[3] = { uniform(-1, 1), uniform(-1, 1), -uniform(2, 10) };
+
+        // H = K [r0 r1 t], with a little noise.
+        double Hd[9];
+        for (int j = 0; j < 3; j++) {
+            double col[3];
+            for (int i = 0; i < 3; i++)
+                col[i] = j < 2 ? R[3*i + j] : T[i];
+
+            Hd[j] = fx*col[0] + cx*col[2] + uniform(-1e-3, 1e-3);
+            Hd[3 + j] = fy*col[1] + cy*col[2] + uniform(-1e-3, 1e-3);
+            Hd[6 + j] = col[2];
+        }
+
+        H[iter] = matd_create_data(3, 3, Hd);
+    }
+
+    int64_t t0 = utime_now();
+    for (int iter = 0; iter < iters; iter++)
+        expected[iter] = pose_reference(H[iter], fx, fy, cx, cy);
+
+    int64_t t1 = utime_now();
+    for (int iter = 0; iter < iters; iter++)
+        pose[iter] = homography_to_pose(H[iter], fx, fy, cx, cy);
+    int64_t t2 = utime_now();
+
+    double max_err = 0;
+    for (int iter = 0; iter < iters; iter++) {
+        max_err = fmax(max_err, max_diff(expected[iter]->data, pose[iter]->data, 16));
+
+        matd_destroy(expected[iter]);
+        matd_destroy(pose[iter]);
+        matd_destroy(H[iter]);
+    }
+
+    cout << setw(18) << left << "homography_to_pose" << right
+         << setw(13) << fixed << setprecision(1) << 1.0E3 * (t1 - t0) / iters
+         << setw(11) << 1.0E3 * (t2 - t1) / iters
+         << setw(16) << scientific << setprecision(2) << max_err << endl;
+
+    if (max_err > 1e-9)
+        nfailures++;
+
+    return nfailures ? 1 : 0;
+}
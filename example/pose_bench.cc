@@ -0,0 +1,463 @@
+/* Copyright (C) 2013-2016, The Regents of The University of Michigan.
+All rights reserved.
+
+This software was developed in the APRIL Robotics Lab under the
+direction of Edwin Olson, ebolson@umich.edu. This software may be
+available under alternative licensing terms; contact the address above.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+The views and conclusions contained in the software and documentation are those
+of the authors and should not be interpreted as representing official policies,
+either expressed or implied, of the Regents of The University of Michigan.
+*/
+
+// Checks apriltag_detections_estimate_pose() on detections synthesized
+// from random tag poses, without and with noise on the corners, and
+// times it against homography_to_pose(). Then does the same for
+// apriltag_bundles_estimate_pose() on two boards of tags, against
+// averaging per-tag poses.
+//
+// usage: pose_bench [ntags]
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <stdint.h>
+
+#include "apriltag.h"
+#include "apriltag_pose.h"
+#include "tag36h11.h"
+#include "common/homography.h"
+#include "common/matd.h"
+#include "common/time_util.h"
+
+using namespace std;
+
+struct truth
+{
+    double R[9];
+    double t[3];
+};
+
+static double uniform(double lo, double hi)
+{
+    return lo + (hi - lo) * (rand() / (double) RAND_MAX);
+}
+
+static double gaussian()
+{
+    double u = uniform(1e-12, 1), v = uniform(0, 1);
+    return sqrt(-2*log(u)) * cos(2*M_PI*v);
+}
+
+// rotation by theta about the unit axis k (Rodrigues' formula).
+static void axis_angle(const double k[3], double theta, double R[9])
+{
+    double c = cos(theta), s = sin(theta);
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++)
+            R[3*i + j] = (i == j ? c : 0) + (1 - c)*k[i]*k[j];
+    R[1] -= s*k[2]; R[3] += s*k[2];
+    R[2] += s*k[1]; R[6] -= s*k[1];
+    R[5] -= s*k[0]; R[7] += s*k[0];
+}
+
+static void project(const apriltag_pose_params_t &params, const double *R, const double *t,
+                    double x, double y, double *u, double *v)
+{
+    double X[3];
+    for (int k = 0; k < 3; k++)
+        X[k] = R[3*k + 0]*x + R[3*k + 1]*y + t[k];
+    *u = params.fx*X[0]/X[2] + params.cx;
+    *v = params.fy*X[1]/X[2] + params.cy;
+}
+
+// A random pose in front of the camera, turned at most 60 degrees
+// away from it.
+static void random_pose(double min_depth, double max_depth, truth &tr)
+{
+    double tilt_axis = uniform(-M_PI, M_PI);
+    double k[3] = { cos(tilt_axis), sin(tilt_axis), 0 };
+    double z[3] = { 0, 0, 1 };
+
+    double tilt[9], spin[9];
+    axis_angle(k, uniform(0, M_PI / 3), tilt);
+    axis_angle(z, uniform(-M_PI, M_PI), spin);
+    matd33_multiply(tilt, spin, tr.R);
+
+    double depth = uniform(min_depth, max_depth);
+    tr.t[0] = depth * uniform(-.4, .4);
+    tr.t[1] = depth * uniform(-.3, .3);
+    tr.t[2] = depth;
+}
+
+// The detection of a tag of the given size at pose tr, with noise of
+// the given standard deviation (in pixels) on the corners.
+static void make_detection(const apriltag_pose_params_t &params, double tagsize, double noise,
+                           const truth &tr, apriltag_detection_t &det)
+{
+    memset(&det, 0, sizeof(det));
+
+    // det->p wraps (-1,1), (1,1), (1,-1), (-1,-1); the homography
+    // is fit to the square (-1,-1), (1,-1), (1,1), (-1,1).
+    double h = tagsize / 2;
+    double square[4][2];
+    for (int i = 0; i < 4; i++) {
+        double tx = (i == 1 || i == 2) ? 1 : -1, ty = (i < 2) ? 1 : -1;
+        project(params, tr.R, tr.t, h*tx, h*ty, &det.p[i][0], &det.p[i][1]);
+        det.p[i][0] += noise * gaussian();
+        det.p[i][1] += noise * gaussian();
+
+        square[3 - i][0] = det.p[i][0];
+        square[3 - i][1] = det.p[i][1];
+    }
+
+    homography33_square_to_quad(square, det.H);
+    homography33_project(det.H, 0, 0, &det.c[0], &det.c[1]);
+}
+
+// the angle of the rotation between A and B: ||A - B|| = 2 sqrt(2) sin(angle / 2).
+static double rotation_error_deg(const double *A, const double *B)
+{
+    double d2 = 0;
+    for (int i = 0; i < 9; i++)
+        d2 += (A[i] - B[i])*(A[i] - B[i]);
+    return 2 * asin(fmin(1, sqrt(d2 / 8))) * 180 / M_PI;
+}
+
+static double translation_error(const double *a, const double *b)
+{
+    double d2 = 0, t2 = 0;
+    for (int k = 0; k < 3; k++) {
+        d2 += (a[k] - b[k])*(a[k] - b[k]);
+        t2 += b[k]*b[k];
+    }
+    return sqrt(d2 / t2);
+}
+
+// Two 5x5 boards of 4 cm tags at a 5 cm pitch, ids 0-24 and 30-54,
+// each at a random pose in every frame with about 70% of its tags
+// visible, among a few tags of neither board. Compares the bundle
+// poses with averaging the boards' poses implied by each tag's pose.
+// Returns the number of failures.
+static int test_bundles(apriltag_detector_t *td, apriltag_pose_params_t params, int nframes)
+{
+    const apriltag_family_t *fam = tag36h11_family();
+    const int nboards = 2, side = 5;
+    const double tagsize = 0.04, pitch = 0.05;
+
+    params.tagsize = tagsize;
+    params.tagsizes = NULL;
+
+    // the tag frames in the board frame
+    vector<truth> layout(side*side);
+    apriltag_bundle_t *bundles[nboards];
+    int nfailures = 0;
+
+    for (int b = 0; b < nboards; b++) {
+        bundles[b] = apriltag_bundle_create();
+
+        for (int j = 0; j < side*side; j++) {
+            truth &l = layout[j];
+            double z[3] = { 0, 0, 1 };
+            axis_angle(z, (j % 4) * M_PI / 2, l.R);
+            l.t[0] = (j % side - side / 2) * pitch;
+            l.t[1] = (j / side - side / 2) * pitch;
+            l.t[2] = 0;
+
+            if (apriltag_bundle_add_tag_pose(bundles[b], fam, 30*b + j, tagsize, l.R, l.t))
+                nfailures++;
+        }
+    }
+
+    cout << endl << "noise px  method        us/frame  rot err deg  trans err" << endl;
+
+    const double noises[] = { 0, 0.5 };
+
+    for (int n = 0; n < 2; n++) {
+        double noise = noises[n];
+        double bundle_us = 0, bundle_rot = 0, bundle_trans = 0;
+        double average_us = 0, average_rot = 0, average_trans = 0;
+        int nmissing = 0;
+
+        zarray_t *detections = zarray_create(sizeof(apriltag_detection_t));
+        vector<int> boards;
+        vector<apriltag_pose_t> tag_poses;
+
+        for (int frame = 0; frame < nframes; frame++) {
+            truth board_truth[nboards];
+            int nvisible[nboards];
+
+            zarray_clear(detections);
+            boards.clear();
+
+            for (int b = 0; b < nboards; b++) {
+                random_pose(0.4, 2.5, board_truth[b]);
+                nvisible[b] = 0;
+
+                for (int j = 0; j < side*side; j++) {
+                    if (uniform(0, 1) < 0.3)
+                        continue;
+
+                    truth tag;
+                    matd33_multiply(board_truth[b].R, layout[j].R, tag.R);
+                    for (int k = 0; k < 3; k++)
+                        tag.t[k] = board_truth[b].t[k] + board_truth[b].R[3*k + 0]*layout[j].t[0] +
+                            board_truth[b].R[3*k + 1]*layout[j].t[1] + board_truth[b].R[3*k + 2]*layout[j].t[2];
+
+                    apriltag_detection_t det;
+                    make_detection(params, tagsize, noise, tag, det);
+                    det.family = fam;
+                    det.id = 30*b + j;
+                    zarray_add(detections, &det);
+                    boards.push_back(b);
+                    nvisible[b]++;
+                }
+            }
+
+            for (int k = 0; k < 3; k++) {
+                truth other;
+                random_pose(0.5, 4, other);
+
+                apriltag_detection_t det;
+                make_detection(params, tagsize, noise, other, det);
+                det.family = fam;
+                det.id = 100 + k;
+                zarray_add(detections, &det);
+                boards.push_back(-1);
+            }
+
+            apriltag_pose_t poses[nboards];
+
+            int64_t t0 = utime_now();
+            apriltag_bundles_estimate_pose(td, detections, &params, bundles, nboards, poses);
+            int64_t t1 = utime_now();
+
+            // the per-tag alternative: each tag's pose implies the
+            // board's, and their rotations and translations are
+            // averaged.
+            tag_poses.resize(zarray_size(detections));
+            apriltag_detections_estimate_pose(td, detections, &params, &tag_poses[0]);
+
+            double sumR[nboards][9], sumt[nboards][3];
+            memset(sumR, 0, sizeof(sumR));
+            memset(sumt, 0, sizeof(sumt));
+
+            for (int i = 0; i < zarray_size(detections); i++) {
+                int b = boards[i];
+                if (b < 0)
+                    continue;
+
+                apriltag_detection_t *det;
+                zarray_get_volatile(detections, i, &det);
+                const truth &l = layout[det->id - 30*b];
+
+                double R[9];
+                matd33_multiply_transpose(tag_poses[i].R, l.R, R);
+                for (int k = 0; k < 9; k++)
+                    sumR[b][k] += R[k];
+                for (int k = 0; k < 3; k++)
+                    sumt[b][k] += (tag_poses[i].t[k] - R[3*k + 0]*l.t[0] - R[3*k + 1]*l.t[1] - R[3*k + 2]*l.t[2]) / nvisible[b];
+            }
+            int64_t t2 = utime_now();
+
+            bundle_us += (t1 - t0) / (double) nframes;
+            average_us += (t2 - t1) / (double) nframes;
+
+            for (int b = 0; b < nboards; b++) {
+                if (poses[b].ntags != nvisible[b])
+                    nmissing++;
+
+                double R[9];
+                matd33_polar(sumR[b], R);
+
+                bundle_rot += rotation_error_deg(poses[b].R, board_truth[b].R) / (nboards * nframes);
+                bundle_trans += translation_error(poses[b].t, board_truth[b].t) / (nboards * nframes);
+                average_rot += rotation_error_deg(R, board_truth[b].R) / (nboards * nframes);
+                average_trans += translation_error(sumt[b], board_truth[b].t) / (nboards * nframes);
+            }
+        }
+
+        zarray_destroy(detections);
+
+        cout << setw(8) << fixed << setprecision(1) << noise << "  bundle     "
+             << setw(11) << setprecision(2) << bundle_us
+             << setw(13) << scientific << bundle_rot
+             << setw(11) << bundle_trans << endl;
+        cout << setw(8) << fixed << setprecision(1) << noise << "  per-tag avg"
+             << setw(11) << setprecision(2) << average_us
+             << setw(13) << scientific << average_rot
+             << setw(11) << average_trans << endl;
+
+        if (nmissing) {
+            cout << nmissing << " bundle poses were not fit to every visible tag" << endl;
+            nfailures++;
+        }
+
+        // exact corners must give the true poses; noisy ones must do
+        // better than averaging.
+        if (noise == 0 ? (bundle_rot > 1e-6 || bundle_trans > 1e-8)
+            : (bundle_rot > average_rot || bundle_trans > average_trans))
+            nfailures++;
+    }
+
+    for (int b = 0; b < nboards; b++)
+        apriltag_bundle_destroy(bundles[b]);
+
+    return nfailures;
+}
+
+int main(int argc, char *argv[])
+{
+    int ntags = argc > 1 ? atoi(argv[1]) : 2000;
+
+    srand(0);
+
+    apriltag_detector_t *td = apriltag_detector_create();
+
+    apriltag_pose_params_t params;
+    params.fx = 800;
+    params.fy = 800;
+    params.cx = 640;
+    params.cy = 480;
+    params.tagsize = 0.16;
+    params.tagsizes = NULL;
+
+    int nfailures = 0;
+
+    cout << "noise px  threads  us/tag  homography_to_pose us/tag  rot err deg  trans err  reproj px  truth px  iters" << endl;
+
+    const double noises[] = { 0, 0.5 };
+
+    for (int n = 0; n < 2; n++) {
+        double noise = noises[n];
+
+        vector<truth> truths(ntags);
+        zarray_t *detections = zarray_create(sizeof(apriltag_detection_t));
+        zarray_t *pointers = zarray_create(sizeof(apriltag_detection_t*));
+
+        for (int i = 0; i < ntags; i++) {
+            apriltag_detection_t det;
+            random_pose(0.5, 4, truths[i]);
+            make_detection(params, params.tagsize, noise, truths[i], det);
+            zarray_add(detections, &det);
+        }
+
+        for (int i = 0; i < ntags; i++) {
+            apriltag_detection_t *det;
+            zarray_get_volatile(detections, i, &det);
+            zarray_add(pointers, &det);
+        }
+
+        // the reprojection error of the true poses
+        double truth_err = 0;
+        for (int i = 0; i < ntags; i++) {
+            apriltag_detection_t *det;
+            zarray_get_volatile(detections, i, &det);
+
+            double err2 = 0, h = params.tagsize / 2;
+            for (int j = 0; j < 4; j++) {
+                double u, v;
+                project(params, truths[i].R, truths[i].t, h*((j == 1 || j == 2) ? 1 : -1), h*(j < 2 ? 1 : -1), &u, &v);
+                err2 += (u - det->p[j][0])*(u - det->p[j][0]) + (v - det->p[j][1])*(v - det->p[j][1]);
+            }
+            truth_err += sqrt(err2 / 4) / ntags;
+        }
+
+        // the old path, for comparison.
+        int64_t t0 = utime_now();
+        for (int i = 0; i < ntags; i++) {
+            apriltag_detection_t *det;
+            zarray_get_volatile(detections, i, &det);
+            matd_t *H = apriltag_detection_get_H(det);
+            matd_t *pose = homography_to_pose(H, -params.fx, params.fy, params.cx, params.cy);
+            matd_destroy(pose);
+            matd_destroy(H);
+        }
+        double homography_us = (utime_now() - t0) / (double) ntags;
+
+        vector<apriltag_pose_t> poses(ntags), reference(ntags);
+
+        for (int nthreads = 1; nthreads <= 2; nthreads++) {
+            td->nthreads = nthreads;
+
+            // warm up the worker pool
+            apriltag_detections_estimate_pose(td, pointers, &params, &reference[0]);
+
+            int64_t t1 = utime_now();
+            apriltag_detections_estimate_pose(td, detections, &params, &poses[0]);
+            double us = (utime_now() - t1) / (double) ntags;
+
+            double rot_err = 0, trans_err = 0, reproj_err = 0, iters = 0;
+            int ndifferent = 0;
+
+            for (int i = 0; i < ntags; i++) {
+                const apriltag_pose_t &pose = poses[i];
+
+                rot_err += rotation_error_deg(pose.R, truths[i].R) / ntags;
+                double d2 = 0, t2 = 0;
+                for (int k = 0; k < 3; k++) {
+                    d2 += (pose.t[k] - truths[i].t[k])*(pose.t[k] - truths[i].t[k]);
+                    t2 += truths[i].t[k]*truths[i].t[k];
+                }
+                trans_err += sqrt(d2 / t2) / ntags;
+                reproj_err += pose.reprojection_error / ntags;
+                iters += pose.niters / (double) ntags;
+
+                if (memcmp(&pose, &reference[i], sizeof(pose)))
+                    ndifferent++;
+            }
+
+            cout << setw(8) << fixed << setprecision(1) << noise
+                 << setw(9) << nthreads
+                 << setw(8) << setprecision(2) << us
+                 << setw(27) << homography_us
+                 << setw(13) << scientific << setprecision(2) << rot_err
+                 << setw(11) << trans_err
+                 << setw(11) << reproj_err
+                 << setw(10) << truth_err
+                 << setw(7) << fixed << setprecision(1) << iters << endl;
+
+            if (ndifferent) {
+                cout << ndifferent << " poses depend on the kind of detections array" << endl;
+                nfailures++;
+            }
+
+            // exact corners must give the true pose; noisy ones a pose
+            // that fits them at least as well as the true one.
+            if (noise == 0 ? (rot_err > 1e-6 || trans_err > 1e-8 || reproj_err > 1e-6) : reproj_err > truth_err)
+                nfailures++;
+        }
+
+        zarray_destroy(pointers);
+        zarray_destroy(detections);
+    }
+
+    nfailures += test_bundles(td, params, ntags / 10);
+
+    apriltag_detector_destroy(td);
+
+    return nfailures ? 1 : 0;
+}